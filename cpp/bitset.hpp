@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <cassert>
@@ -91,6 +92,8 @@ class Bitset {
 
   constexpr auto flip() -> Bitset& {
     std::ranges::for_each(bits, [](underlying_t &word) -> void { word = ~word; });
+    get_msb_word() &= get_msb_mask();
+    return *this;
   }
 
   constexpr auto flip(std::size_t pos) -> Bitset& {
@@ -146,11 +149,16 @@ class Bitset {
     return bits[which_word(pos)];
   }
 
+  [[nodiscard]] constexpr auto get_word(std::size_t pos) const -> underlying_t {
+    assert(pos < size());
+    return bits[which_word(pos)];
+  }
+
   [[nodiscard]] constexpr auto get_msb_word() -> underlying_t& {
     return bits[arr_size - 1];
   }
 
-  [[nodiscard]] constexpr auto to_bool(underlying_t in) -> bool {
+  [[nodiscard]] constexpr static auto to_bool(underlying_t in) -> bool {
     return in & 0b1;
   }
 };
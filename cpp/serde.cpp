@@ -1,9 +1,47 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <expected>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <print>
+#include <ranges>
 #include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <type_traits>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+ #include <linux/io_uring.h>
+ #include <sys/mman.h>
+ #include <sys/syscall.h>
+#endif
+
+#if defined(__SSE2__)
+ #include <immintrin.h>
+#endif
+
 #if defined(__has_cpp_attribute)
  #if __has_cpp_attribute(clang::lifetimebound)
   #define lifetimebound [[clang::lifetimebound]]
@@ -52,104 +90,2833 @@ constexpr auto asMutBytes(T &t lifetimebound) -> MutByteSpan
 template<typename T>
 constexpr auto asMutBytes(T &&t) -> MutByteSpan = delete;
 
+// Buffer pools
+//
+// ByteBuffer storage comes from a pool per thread, which keeps freed blocks
+// in power-of-two size classes and hands them out again, so code that keeps
+// creating and dropping buffers stops calling malloc once it has warmed up.
+// Every trim_interval releases the pool trims each class to the most blocks
+// that were in use at once since the last trim, returning memory after a
+// burst. A run of releases alone says nothing about demand, so the count
+// starts over at the next allocation; dropping a large working set at once
+// then keeps it cached for the next round.
+//
+// A block freed on another thread joins that thread's pool, not the one it
+// came from, and nothing hands it back. When buffers are filled on one
+// thread and dropped on another, the filling thread keeps allocating fresh
+// blocks while the dropping one caches them until its next trim. Steady
+// state is malloc-free only for buffers released on the thread that
+// allocated them, so hand such buffers back, or reuse them with clear().
+
+class BufferPool {
+ public:
+  static constexpr std::size_t min_block = 256;
+  static constexpr std::size_t max_block = 64 << 20;
+  static constexpr std::size_t trim_interval = 1024;
+
+  BufferPool() = default;
+  BufferPool(const BufferPool &) = delete;
+  auto operator=(const BufferPool &) -> BufferPool & = delete;
+
+  ~BufferPool()
+  {
+    for (auto &k : classes_) {
+      while (k.free != nullptr) ::operator delete(std::exchange(k.free, k.free->next));
+    }
+    destroyed() = true;
+  }
+
+  // The size of the block that allocate(n) returns.
+  static auto blockSize(std::size_t n) -> std::size_t
+  {
+    return n > max_block ? n : min_block << sizeClass(n);
+  }
+
+  auto allocate(std::size_t n) -> void *
+  {
+    if (n > max_block) return ::operator new(n);
+
+    auto &k = classes_[sizeClass(n)];
+    void *p;
+    if (k.free != nullptr) {
+      --k.cached;
+      p = std::exchange(k.free, k.free->next);
+    } else {
+      p = ::operator new(blockSize(n));
+      ++fresh_blocks_;
+    }
+    k.high_water = std::max(k.high_water, ++k.in_use);
+    // Releases before this allocation said nothing about demand
+    if (!std::exchange(allocated_, true)) releases_ = 0;
+    return p;
+  }
+
+  // Takes back a block that allocate(n) returned.
+  void deallocate(void *p, std::size_t n)
+  {
+    if (n > max_block) return ::operator delete(p);
+
+    auto &k = classes_[sizeClass(n)];
+    k.free = ::new (p) Block{k.free};
+    ++k.cached;
+    if (k.in_use > 0) --k.in_use;
+    if (++releases_ >= trim_interval && allocated_) trim();
+  }
+
+  // Frees the cached blocks of each class beyond the most that were in use
+  // at once since the last trim.
+  void trim()
+  {
+    for (auto &k : classes_) {
+      for (; k.cached > k.high_water - k.in_use; --k.cached) ::operator delete(std::exchange(k.free, k.free->next));
+      k.high_water = k.in_use;
+    }
+    releases_ = 0;
+    allocated_ = false;
+  }
+
+  // Bytes held for reuse.
+  auto cached() const -> std::size_t
+  {
+    std::size_t bytes = 0;
+    for (std::size_t c = 0; c < classes_.size(); ++c) bytes += classes_[c].cached * (min_block << c);
+    return bytes;
+  }
+
+  // How many blocks came from operator new rather than the cache.
+  auto freshBlocks() const -> std::size_t
+  {
+    return fresh_blocks_;
+  }
+
+  static auto local() -> BufferPool &
+  {
+    thread_local BufferPool pool;
+    return pool;
+  }
+
+  // Returns `p` to the pool of this thread, or to the heap once that pool
+  // is gone during thread exit. The pool that allocated `p` does not get it
+  // back if that was another thread's.
+  static void release(void *p, std::size_t n)
+  {
+    if (destroyed())
+      ::operator delete(p);
+    else
+      local().deallocate(p, n);
+  }
+
+ private:
+  struct Block {
+    Block *next;
+  };
+
+  // Counts of blocks of one size
+  struct SizeClass {
+    Block *free{nullptr};
+    std::size_t cached{0};
+    std::size_t in_use{0};
+    std::size_t high_water{0};
+  };
+
+  static auto sizeClass(std::size_t n) -> std::size_t
+  {
+    return static_cast<std::size_t>(std::bit_width((std::max(n, min_block) - 1) / min_block));
+  }
+
+  static auto destroyed() -> bool &
+  {
+    thread_local bool gone = false;
+    return gone;
+  }
+
+  std::array<SizeClass, std::countr_zero(max_block / min_block) + 1> classes_{};
+  // Since the first allocation after the last trim
+  std::size_t releases_{0};
+  bool allocated_{false};
+  std::size_t fresh_blocks_{0};
+};
+
 class ByteBuffer {
  public:
   ByteBuffer(std::size_t size = 128)
   {
-    bytes_.reserve(size);
+    grow(size);
+  }
+
+  ByteBuffer(ByteSpan b) : ByteBuffer(b.size())
+  {
+    write(b);
+  }
+
+  ByteBuffer(const ByteVec &b) : ByteBuffer(ByteSpan(b)) { }
+
+  ByteBuffer(const ByteBuffer &other) : ByteBuffer(other.bytes()) { }
+
+  ByteBuffer(ByteBuffer &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)), capacity_(std::exchange(other.capacity_, 0))
+  {
   }
 
-  ByteBuffer(ByteSpan b) : bytes_(b.begin(), b.end()) { }
+  auto operator=(ByteBuffer other) noexcept -> ByteBuffer &
+  {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    return *this;
+  }
 
-  ByteBuffer(ByteVec b) : bytes_(std::move(b)) { }
+  ~ByteBuffer()
+  {
+    if (data_ != nullptr) BufferPool::release(data_, capacity_);
+  }
 
   auto bytes() const lifetimebound -> ByteSpan
   {
-    return bytes_;
+    return {data_, size_};
   }
 
   auto size() const -> std::size_t
   {
-    return bytes_.size();
+    return size_;
   }
 
   void clear()
   {
-    bytes_.clear();
+    size_ = 0;
+  }
+
+  // Makes room for `extra` more bytes, growing geometrically.
+  void reserve(std::size_t extra)
+  {
+    if (size_ + extra > capacity_) grow(std::max(size_ + extra, 2 * capacity_));
   }
 
   std::size_t write(ByteSpan bytes)
   {
-    const auto old_size = bytes_.size();
-    std::copy(bytes.begin(), bytes.end(), std::back_inserter(bytes_));
-    return bytes_.size() - old_size;
+    reserve(bytes.size());
+    std::copy_n(bytes.data(), bytes.size(), data_ + size_);
+    size_ += bytes.size();
+    return bytes.size();
   }
 
  private:
-  ByteVec bytes_;
+  // Moves the contents into a pool block of at least `capacity` bytes.
+  void grow(std::size_t capacity)
+  {
+    capacity = BufferPool::blockSize(capacity);
+    auto *data = static_cast<std::byte *>(BufferPool::local().allocate(capacity));
+    std::copy_n(data_, size_, data);
+    if (data_ != nullptr) BufferPool::release(data_, capacity_);
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  std::byte *data_{nullptr};
+  std::size_t size_{0};
+  std::size_t capacity_{0};
 };
 
-class OByteStream {
+// Scatter-gather output
+//
+// GatherBuffer collects output as a list of iovecs and hands it to writev in
+// one call. Borrowed spans of at least `borrow_threshold` bytes are
+// referenced in place, so they must outlive the next flush; everything else
+// is copied into chunks the buffer owns and reuses. Adjacent pieces share an
+// iovec, and empty ones are dropped.
+
+class GatherBuffer {
  public:
-  OByteStream(ByteBuffer &b) : buffer_(b) { }
+  explicit GatherBuffer(std::size_t borrow_threshold = 256) : borrow_threshold_(borrow_threshold) { }
 
-  template<typename T>
-  void write(const T &t)
+  auto size() const -> std::size_t
   {
-    write(asBytes(t));
+    return size_;
   }
 
-  void write(ByteSpan bytes)
+  auto iovecs() const lifetimebound -> std::span<const iovec>
   {
-    buffer_.write(bytes);
+    return iov_;
   }
 
-  auto operator<<(const auto &t) -> OByteStream &
+  void clear()
   {
-    write(t);
-    return *this;
+    iov_.clear();
+    chunks_used_ = 0;
+    used_ = chunk_size;
+    size_ = 0;
+  }
+
+  std::size_t write(ByteSpan bytes)
+  {
+    const auto total = bytes.size();
+    size_ += bytes.size();
+    while (!bytes.empty()) {
+      if (used_ == chunk_size) nextChunk();
+      const auto n = std::min(bytes.size(), chunk_size - used_);
+      auto *out = chunks_[chunks_used_ - 1].get() + used_;
+      std::memcpy(out, bytes.data(), n);
+      append(out, n);
+      used_ += n;
+      bytes = bytes.subspan(n);
+    }
+    return total;
+  }
+
+  void borrow(ByteSpan bytes)
+  {
+    if (bytes.empty()) return;
+    if (bytes.size() < borrow_threshold_) {
+      write(bytes);
+    } else {
+      append(bytes.data(), bytes.size());
+      size_ += bytes.size();
+    }
+  }
+
+  // Writes everything to `fd` and empties the buffer. On failure returns
+  // false with errno set, leaving the bytes not yet written in the buffer.
+  auto flush(int fd) -> bool
+  {
+    std::size_t first = 0;
+    while (first < iov_.size()) {
+      const auto count = std::min<std::size_t>(iov_.size() - first, IOV_MAX);
+      const auto written = ::writev(fd, iov_.data() + first, static_cast<int>(count));
+      if (written < 0) {
+        if (errno == EINTR) continue;
+        iov_.erase(iov_.begin(), iov_.begin() + static_cast<std::ptrdiff_t>(first));
+        return false;
+      }
+
+      // Skip what was written, trimming an iovec written in part
+      auto left = static_cast<std::size_t>(written);
+      size_ -= left;
+      while (left > 0 && left >= iov_[first].iov_len) left -= iov_[first++].iov_len;
+      if (left > 0) {
+        iov_[first].iov_base = static_cast<std::byte *>(iov_[first].iov_base) + left;
+        iov_[first].iov_len -= left;
+      }
+    }
+    clear();
+    return true;
   }
 
  private:
-  ByteBuffer &buffer_;
+  static constexpr std::size_t chunk_size = 4096;
+
+  void nextChunk()
+  {
+    if (chunks_used_ == chunks_.size()) chunks_.push_back(std::make_unique_for_overwrite<std::byte[]>(chunk_size));
+    ++chunks_used_;
+    used_ = 0;
+  }
+
+  void append(const std::byte *p, std::size_t n)
+  {
+    if (!iov_.empty() && static_cast<const std::byte *>(iov_.back().iov_base) + iov_.back().iov_len == p)
+      iov_.back().iov_len += n;
+    else
+      iov_.push_back({const_cast<std::byte *>(p), n});
+  }
+
+  std::size_t borrow_threshold_;
+  std::vector<iovec> iov_;
+  std::vector<std::unique_ptr<std::byte[]>> chunks_;
+  std::size_t chunks_used_{0};
+  std::size_t used_{chunk_size};
+  std::size_t size_{0};
 };
 
-class IByteStream {
+// Segmented buffers
+//
+// SegmentedBuffer grows by chaining fixed-size segments taken from the
+// thread's BufferPool, so appending never moves what is already written and
+// the pool's trimming bounds what idle segments hold. Writes that fit in the
+// current segment are a single copy. A segmented IByteStream reads the
+// segments as one sequence: values inside a segment are read in place, and
+// the few that straddle a boundary are stitched together into a buffer owned
+// by the stream, so views of those live as long as the stream does.
+
+class SegmentedBuffer {
  public:
-  IByteStream(ByteSpan bytes) : begin_(bytes.data()), current_(bytes.data()), end_(bytes.data() + bytes.size()) { }
+  static constexpr std::size_t segment_size = 16 << 10;
 
-  IByteStream(ByteBuffer &buf) : IByteStream(buf.bytes()) { }
+  SegmentedBuffer() = default;
 
-  template<typename T>
-  requires std::is_trivially_copyable_v<T>
-  auto operator>>(T &t) -> IByteStream &
+  SegmentedBuffer(SegmentedBuffer &&other) noexcept
+      : segments_(std::move(other.segments_)),
+        cursor_(std::exchange(other.cursor_, nullptr)),
+        limit_(std::exchange(other.limit_, nullptr)),
+        size_(std::exchange(other.size_, 0))
   {
-    assert((current_ + sizeof(T)) <= end_);
-
-    t = fromBytesTo<T>({current_, sizeof(T)});
-    current_ += sizeof(T);
+  }
 
+  auto operator=(SegmentedBuffer &&other) noexcept -> SegmentedBuffer &
+  {
+    if (this != &other) {
+      release(0);
+      segments_ = std::move(other.segments_);
+      cursor_ = std::exchange(other.cursor_, nullptr);
+      limit_ = std::exchange(other.limit_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
     return *this;
   }
 
+  ~SegmentedBuffer()
+  {
+    release(0);
+  }
+
+  auto size() const -> std::size_t
+  {
+    return size_;
+  }
+
+  // The written bytes, one span per segment. The spans stay valid until the
+  // next call.
+  auto segments() const lifetimebound -> std::span<const ByteSpan>
+  {
+    spans_.clear();
+    for (std::size_t i = 0; i < segments_.size(); ++i) {
+      const auto length = i + 1 < segments_.size() ? segment_size : segment_size - static_cast<std::size_t>(limit_ - cursor_);
+      spans_.emplace_back(segments_[i], length);
+    }
+    return spans_;
+  }
+
+  // Empties the buffer, keeping its first segment.
+  void clear()
+  {
+    release(1);
+    cursor_ = segments_.empty() ? nullptr : segments_.front();
+    limit_ = segments_.empty() ? nullptr : cursor_ + segment_size;
+    size_ = 0;
+  }
+
+  std::size_t write(ByteSpan bytes)
+  {
+    size_ += bytes.size();
+    if (bytes.size() <= static_cast<std::size_t>(limit_ - cursor_)) [[likely]] {
+      cursor_ = std::copy_n(bytes.data(), bytes.size(), cursor_);
+      return bytes.size();
+    }
+
+    const auto total = bytes.size();
+    while (!bytes.empty()) {
+      if (cursor_ == limit_) {
+        segments_.push_back(static_cast<std::byte *>(BufferPool::local().allocate(segment_size)));
+        cursor_ = segments_.back();
+        limit_ = cursor_ + segment_size;
+      }
+      const auto n = std::min(bytes.size(), static_cast<std::size_t>(limit_ - cursor_));
+      cursor_ = std::copy_n(bytes.data(), n, cursor_);
+      bytes = bytes.subspan(n);
+    }
+    return total;
+  }
+
  private:
-  const std::byte *begin_{nullptr};
-  const std::byte *current_{nullptr};
-  const std::byte *end_{nullptr};
+  // Returns the segments from `keep` on to the pool.
+  void release(std::size_t keep)
+  {
+    while (segments_.size() > keep) {
+      BufferPool::release(segments_.back(), segment_size);
+      segments_.pop_back();
+    }
+  }
+
+  std::vector<std::byte *> segments_;
+  // Free space in the last segment
+  std::byte *cursor_{nullptr};
+  std::byte *limit_{nullptr};
+  std::size_t size_{0};
+  mutable std::vector<ByteSpan> spans_;
 };
 
-int main(int argc, char *argv[])
+// Types that choose their own wire format, such as Varint<T>.
+template<typename T>
+concept CustomEncoded = requires { typename T::wire_encoding; };
+
+template<typename T>
+struct IsOptional : std::false_type { };
+
+template<typename T>
+struct IsOptional<std::optional<T>> : std::true_type { };
+
+// Types written as their object representation. Ranges are written element
+// by element even when trivially copyable, so that views such as
+// std::string_view serialize what they refer to. Optionals always get a
+// presence flag, since their layout means nothing to another build.
+template<typename T>
+concept RawCopyable = std::is_trivially_copyable_v<T> && !std::ranges::range<T> && !CustomEncoded<T> && !IsOptional<T>::value;
+
+// Integer encodings
+//
+// Varint<T> fields are written as LEB128: seven bits per byte, low bits
+// first, with the top bit set on every byte but the last. Signed values are
+// ZigZag mapped first (0, -1, 1, -2, ... become 0, 1, 2, 3, ...) so small
+// magnitudes stay short. GroupVarints packs a vector of 32-bit values four
+// at a time behind a control byte holding their byte lengths, which decodes
+// a whole group with one shuffle.
+
+constexpr std::size_t max_varint_bytes = 10;
+
+template<std::integral T>
+constexpr auto zigzagEncode(T v) -> std::uint64_t
 {
-  ByteBuffer buf;
-  OByteStream ostream{buf};
+  if constexpr (std::is_signed_v<T>)
+    return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(static_cast<std::int64_t>(v) >> 63);
+  else
+    return v;
+}
 
-  ostream << 10 << 0.5F << 0x1122334455667788UL;
+template<std::integral T>
+constexpr auto zigzagDecode(std::uint64_t u) -> T
+{
+  if constexpr (std::is_signed_v<T>)
+    return static_cast<T>(static_cast<std::int64_t>(u >> 1) ^ -static_cast<std::int64_t>(u & 1));
+  else
+    return static_cast<T>(u);
+}
 
-  IByteStream istream{buf};
-  int x;
-  float y;
-  size_t z;
-  istream >> x >> y >> z;
+// Writes the LEB128 encoding of `v` to `out` and returns its length.
+constexpr auto encodeVarint(std::uint64_t v, std::byte *out) -> std::size_t
+{
+  std::size_t n = 0;
+  for (; v >= 0x80; v >>= 7) out[n++] = static_cast<std::byte>(v | 0x80);
+  out[n++] = static_cast<std::byte>(v);
+  return n;
+}
 
-  std::println("{} {} {:#x}", x, y, z);
+// Decodes a LEB128 value from [p, end) and returns its length, or 0 if it
+// is truncated, longer than max_varint_bytes or overflows 64 bits.
+inline auto decodeVarint(const std::byte *p, const std::byte *end, std::uint64_t &v) -> std::size_t
+{
+#if defined(__BMI2__)
+  if (end - p >= 8) {
+    // The first byte without its top bit set ends the value
+    std::uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    if (const auto stops = ~word & 0x8080808080808080) {
+      const auto n = static_cast<std::size_t>(std::countr_zero(stops)) / 8 + 1;
+      v = _pext_u64(word, 0x7f7f7f7f7f7f7f7f >> (64 - 8 * n));
+      return n;
+    }
+  }
+#endif
+  v = 0;
+  for (std::size_t n = 0; n < max_varint_bytes && p + n < end; ++n) {
+    const auto b = std::to_integer<std::uint64_t>(p[n]);
+    // The tenth byte holds bit 63 alone
+    if (n == max_varint_bytes - 1 && b > 1) return 0;
+    v |= (b & 0x7f) << (7 * n);
+    if (b < 0x80) return n + 1;
+  }
+  return 0;
+}
+
+template<std::integral T>
+struct Varint {
+  using wire_encoding = void;
+
+  T value{};
+
+  operator T() const
+  {
+    return value;
+  }
+};
+
+template<typename T>
+Varint(T) -> Varint<T>;
+
+struct GroupVarints {
+  using wire_encoding = void;
+
+  std::vector<std::uint32_t> values;
+};
+
+// Bytes needed for `v`, from 1 to 4.
+constexpr auto groupVarintLength(std::uint32_t v) -> std::size_t
+{
+  return 1 + (v > 0xff) + (v > 0xffff) + (v > 0xffffff);
+}
+
+// Length of the group starting with `control`, from 5 to 17 bytes.
+constexpr auto groupVarintSize(std::byte control) -> std::size_t
+{
+  const auto c = std::to_integer<std::size_t>(control);
+  return 5 + (c & 3) + (c >> 2 & 3) + (c >> 4 & 3) + (c >> 6);
+}
+
+// Writes a control byte and the low bytes of four values to `out` and
+// returns the length, at most 17. `out` must have room for 17 bytes.
+inline auto encodeGroupVarint(const std::uint32_t *values, std::byte *out) -> std::size_t
+{
+  std::uint8_t control = 0;
+  std::size_t n = 1;
+  for (int i = 0; i < 4; ++i) {
+    const auto len = groupVarintLength(values[i]);
+    control |= static_cast<std::uint8_t>((len - 1) << (2 * i));
+    // Store all four bytes and keep `len`; the next value overwrites the rest
+    auto v = values[i];
+    if constexpr (std::endian::native == std::endian::big) v = std::byteswap(v);
+    std::memcpy(out + n, &v, sizeof(v));
+    n += len;
+  }
+  out[0] = static_cast<std::byte>(control);
+  return n;
+}
+
+// pshufb masks spreading the packed values of a group into four 32-bit lanes,
+// indexed by control byte.
+constexpr auto group_varint_shuffles = [] {
+  std::array<std::array<std::uint8_t, 16>, 256> masks{};
+  for (std::size_t control = 0; control < 256; ++control) {
+    std::uint8_t source = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+      const auto len = ((control >> (2 * i)) & 3) + 1;
+      for (std::size_t k = 0; k < 4; ++k) masks[control][4 * i + k] = k < len ? source++ : 0x80;
+    }
+  }
+  return masks;
+}();
+
+// Decodes the group at `p` into four values and returns its length. `end`
+// bounds the input; the caller checks that the whole group is there.
+inline auto decodeGroupVarint(const std::byte *p, const std::byte *end, std::uint32_t *values) -> std::size_t
+{
+  const auto control = std::to_integer<std::uint8_t>(p[0]);
+#if defined(__SSSE3__)
+  if (end - p >= 17) {
+    const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 1));
+    const auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group_varint_shuffles[control].data()));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(values), _mm_shuffle_epi8(data, mask));
+    return groupVarintSize(p[0]);
+  }
+#endif
+  (void)end;
+  std::size_t n = 1;
+  for (int i = 0; i < 4; ++i) {
+    const auto len = ((control >> (2 * i)) & 3) + 1;
+    values[i] = 0;
+    for (int k = 0; k < len; ++k) values[i] |= std::to_integer<std::uint32_t>(p[n++]) << (8 * k);
+  }
+  return n;
+}
+
+// Aggregate reflection
+//
+// The fields of an aggregate are counted by probing how many initializers
+// it accepts, then bound by reference with a structured binding. Aggregates
+// with C array members or base classes are not supported.
+
+struct AnyField {
+  template<typename T>
+  operator T() const;
+};
+
+template<typename T, typename... Fields>
+constexpr auto fieldCount() -> std::size_t
+{
+  if constexpr (requires { T{Fields{}..., AnyField{}}; })
+    return fieldCount<T, Fields..., AnyField>();
+  else
+    return sizeof...(Fields);
+}
+
+constexpr std::size_t max_fields = 12;
+
+#define SERDE_TIE_FIELDS(n, ...)         \
+  if constexpr (fieldCount<T>() == n) {  \
+    auto &[__VA_ARGS__] = t;             \
+    return std::tie(__VA_ARGS__);        \
+  } else
+
+// Returns a tuple of references to the fields of aggregate `t`.
+template<typename T>
+constexpr auto tieFields(T &t)
+{
+  static_assert(fieldCount<T>() <= max_fields, "aggregate has too many fields to reflect");
+  SERDE_TIE_FIELDS(1, a)
+  SERDE_TIE_FIELDS(2, a, b)
+  SERDE_TIE_FIELDS(3, a, b, c)
+  SERDE_TIE_FIELDS(4, a, b, c, d)
+  SERDE_TIE_FIELDS(5, a, b, c, d, e)
+  SERDE_TIE_FIELDS(6, a, b, c, d, e, f)
+  SERDE_TIE_FIELDS(7, a, b, c, d, e, f, g)
+  SERDE_TIE_FIELDS(8, a, b, c, d, e, f, g, h)
+  SERDE_TIE_FIELDS(9, a, b, c, d, e, f, g, h, i)
+  SERDE_TIE_FIELDS(10, a, b, c, d, e, f, g, h, i, j)
+  SERDE_TIE_FIELDS(11, a, b, c, d, e, f, g, h, i, j, k)
+  SERDE_TIE_FIELDS(12, a, b, c, d, e, f, g, h, i, j, k, l)
+  return std::tuple<>{};
+}
+
+#undef SERDE_TIE_FIELDS
+
+template<typename T>
+concept Reflectable = std::is_aggregate_v<T> && !std::ranges::range<T> && !RawCopyable<T> && !CustomEncoded<T>;
+
+// Calls `run(bytes)` for each maximal run of consecutive RawCopyable fields
+// of `t` (padding between them included) and `field(member)` for
+// every other field, in declaration order.
+template<typename T, typename Run, typename Field>
+void forEachFieldRun(T &t, Run run, Field field)
+{
+  using Byte = std::conditional_t<std::is_const_v<T>, const std::byte, std::byte>;
+  Byte *begin = nullptr;
+  Byte *end = nullptr;
+
+  auto flush = [&] {
+    if (begin != end) run(std::span<Byte>(begin, end));
+    begin = end = nullptr;
+  };
+  auto visit = [&]<typename M>(M &member) {
+    using Member = std::remove_cvref_t<M>;
+    if constexpr (RawCopyable<Member>) {
+      auto *bytes = reinterpret_cast<Byte *>(&member);
+      if (begin == nullptr) begin = bytes;
+      end = bytes + sizeof(Member);
+    } else {
+      flush();
+      field(member);
+    }
+  };
+
+  std::apply([&](auto &...members) { (visit(members), ...); }, tieFields(t));
+  flush();
+}
+
+// Containers
+//
+// Containers are written as a 64-bit element count followed by the elements;
+// fixed-size arrays leave out the count. Contiguous ranges of trivially
+// copyable elements are copied as one block.
+
+template<typename C>
+concept FixedSize = std::is_array_v<C> || requires { std::tuple_size<C>::value; };
+
+// Wire formats
+//
+// Native streams copy objects as they are laid out in memory, padding
+// included, so only the same build can read them back. Little and Big
+// streams write every scalar in that byte order and every aggregate field by
+// field without padding, so buffers move between hosts. Objects whose memory
+// already matches the wire (a packed layout, on a host of that byte order)
+// are still copied in one block, and the byte swaps vanish on such hosts.
+
+enum class WireFormat { Native, Little, Big };
+
+static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
+constexpr auto host_wire_format = std::endian::native == std::endian::little ? WireFormat::Little : WireFormat::Big;
+
+// Scalars that only mean something to the process that wrote them, such as
+// addresses, or whose layout varies between ABIs. Native streams copy them;
+// the portable formats reject them.
+template<typename T>
+constexpr bool host_only_scalar = std::is_pointer_v<T> || std::is_member_pointer_v<T> || std::is_null_pointer_v<T> || std::is_same_v<T, long double>;
+
+// Whether `T` has no padding anywhere, so that its bytes are exactly its
+// scalars in declaration order.
+template<typename T>
+constexpr auto isPacked() -> bool
+{
+  if constexpr (std::is_scalar_v<T>) {
+    return !host_only_scalar<T>;
+  } else if constexpr (std::is_array_v<T>) {
+    return isPacked<std::remove_extent_t<T>>();
+  } else if constexpr (FixedSize<T>) {
+    return isPacked<std::ranges::range_value_t<T>>();
+  } else if constexpr (std::is_aggregate_v<T>) {
+    return []<typename... Fields>(std::type_identity<std::tuple<Fields...>>) {
+      return (isPacked<std::remove_cvref_t<Fields>>() && ...) && (sizeof(Fields) + ... + 0) == sizeof(T);
+    }(std::type_identity<decltype(tieFields(std::declval<T &>()))>{});
+  } else {
+    return false;
+  }
+}
+
+// Whether the bytes of a `T` in memory are its encoding in `Format`.
+template<typename T, WireFormat Format>
+concept CopyableAsWire = RawCopyable<T> && (Format == WireFormat::Native || (Format == host_wire_format && isPacked<T>()));
+
+static_assert(CopyableAsWire<int *, WireFormat::Native>);
+static_assert(!CopyableAsWire<int *, WireFormat::Little> && !CopyableAsWire<int *, WireFormat::Big>);
+// Wide characters are swapped when the format is not the host's, so a
+// string_view cannot point at them
+static_assert(!CopyableAsWire<char16_t, host_wire_format == WireFormat::Little ? WireFormat::Big : WireFormat::Little>);
+
+template<typename C, WireFormat Format>
+concept BulkCopyable = std::ranges::contiguous_range<C> && CopyableAsWire<std::ranges::range_value_t<C>, Format>;
+
+// Contiguous scalars that only need a byte swap each.
+template<typename C, WireFormat Format>
+concept BulkSwappable = std::ranges::contiguous_range<C> && std::is_scalar_v<std::ranges::range_value_t<C>> && !BulkCopyable<C, Format>;
+
+// Converts scalar `t` between host byte order and that of `Format`; the
+// conversion is its own inverse.
+template<WireFormat Format, typename T>
+requires std::is_scalar_v<T>
+constexpr auto wireOrder(T t) -> T
+{
+  static_assert(Format == WireFormat::Native || !host_only_scalar<T>, "pointers and long double have no portable encoding");
+  if constexpr (Format == WireFormat::Native || Format == host_wire_format || sizeof(T) == 1) {
+    return t;
+  } else if constexpr (std::is_enum_v<T>) {
+    return static_cast<T>(wireOrder<Format>(std::to_underlying(t)));
+  } else if constexpr (std::is_integral_v<T>) {
+    return std::byteswap(t);
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+    return std::bit_cast<T>(std::byteswap(std::bit_cast<Bits>(t)));
+  }
+}
+
+template<typename T>
+concept TupleLike = requires { std::tuple_size<T>::value; } && !std::ranges::range<T> && !RawCopyable<T>;
+
+// The element type to read into: map entries without the const key.
+template<typename T>
+struct ReadElement {
+  using type = T;
+};
+
+template<typename K, typename V>
+struct ReadElement<std::pair<const K, V>> {
+  using type = std::pair<K, V>;
+};
+
+template<typename T, WireFormat Format = WireFormat::Native>
+class View;
+
+template<typename T, WireFormat Format = WireFormat::Native>
+class ArrayView;
+
+// Streams write to any sink with write(ByteSpan). A sink that also has
+// borrow(ByteSpan) may keep a reference to the bytes instead of copying
+// them, but only for objects written with borrow(), which the caller
+// promises to keep alive and unchanged until the sink is done with them.
+// Even then the stream lends the sink just the bytes of the object itself,
+// such as the payload of a container, and never its own temporaries.
+template<WireFormat Format = WireFormat::Native, typename Sink = ByteBuffer>
+class OByteStream {
+ public:
+  OByteStream(Sink &b) : buffer_(b) { }
+
+  template<RawCopyable T>
+  void write(const T &t)
+  {
+    if constexpr (std::is_scalar_v<T>) {
+      const auto wire = wireOrder<Format>(t);
+      write(asBytes(wire));
+    } else if constexpr (CopyableAsWire<T, Format>) {
+      lend(asBytes(t));
+    } else {
+      writeFields(t);
+    }
+  }
+
+  // Writes an aggregate field by field. Native streams copy each run of
+  // trivially copyable fields as one block.
+  template<Reflectable T>
+  void write(const T &t)
+  {
+    if constexpr (Format == WireFormat::Native)
+      forEachFieldRun(t, [this](ByteSpan run) { lend(run); }, [this](const auto &field) { write(field); });
+    else
+      writeFields(t);
+  }
+
+  template<std::ranges::sized_range C>
+  void write(const C &c)
+  {
+    const auto n = std::ranges::size(c);
+    if constexpr (BulkCopyable<C, Format>) {
+      const auto payload = std::as_bytes(std::span(std::ranges::data(c), n));
+      reserve(sizeof(std::uint64_t) + payload.size());
+      if constexpr (!FixedSize<C>) write(static_cast<std::uint64_t>(n));
+      lend(payload);
+    } else if constexpr (BulkSwappable<C, Format>) {
+      using Element = std::ranges::range_value_t<C>;
+      reserve(sizeof(std::uint64_t) + n * sizeof(Element));
+      if constexpr (!FixedSize<C>) write(static_cast<std::uint64_t>(n));
+      // Swap a block at a time into a local buffer
+      std::array<Element, 512> block;
+      for (std::size_t i = 0; i < n; i += block.size()) {
+        const auto k = std::min(block.size(), n - i);
+        std::transform(std::ranges::data(c) + i, std::ranges::data(c) + i + k, block.begin(), wireOrder<Format, Element>);
+        write(std::as_bytes(std::span(block.data(), k)));
+      }
+    } else {
+      if constexpr (!FixedSize<C>) write(static_cast<std::uint64_t>(n));
+      for (const auto &element : c) write(element);
+    }
+  }
+
+  template<std::integral T>
+  void write(const Varint<T> &v)
+  {
+    std::byte bytes[max_varint_bytes];
+    write(ByteSpan(bytes, encodeVarint(zigzagEncode(v.value), bytes)));
+  }
+
+  // Writes the count as a varint, then the values in groups of four, the
+  // last one padded with zeros.
+  void write(const GroupVarints &g)
+  {
+    const auto &values = g.values;
+    write(Varint{values.size()});
+
+    std::array<std::byte, 17 * 64> chunk;
+    std::size_t used = 0;
+    for (std::size_t i = 0; i < values.size(); i += 4) {
+      std::array<std::uint32_t, 4> group{};
+      std::copy_n(values.begin() + i, std::min<std::size_t>(4, values.size() - i), group.begin());
+      used += encodeGroupVarint(group.data(), chunk.data() + used);
+      if (used > chunk.size() - 17) {
+        write(ByteSpan(chunk.data(), used));
+        used = 0;
+      }
+    }
+    write(ByteSpan(chunk.data(), used));
+  }
+
+  template<TupleLike T>
+  void write(const T &t)
+  {
+    std::apply([this](const auto &...elements) { (write(elements), ...); }, t);
+  }
+
+  template<typename T>
+  void write(const std::optional<T> &o)
+  {
+    write(o.has_value());
+    if (o) write(*o);
+  }
+
+  // Views hold encoded bytes already, which are copied through.
+  template<typename T>
+  void write(const View<T, Format> &v)
+  {
+    lend(v.bytes());
+  }
+
+  template<typename T>
+  void write(const ArrayView<T, Format> &a)
+  {
+    write(static_cast<std::uint64_t>(a.size()));
+    lend(a.bytes());
+  }
+
+  void write(ByteSpan bytes)
+  {
+    buffer_.write(bytes);
+  }
+
+  // Writes bytes that stay alive and unchanged until the sink is done with
+  // them, letting a sink that can refer to them skip the copy.
+  void borrow(ByteSpan bytes)
+  {
+    if constexpr (requires { buffer_.borrow(bytes); })
+      buffer_.borrow(bytes);
+    else
+      buffer_.write(bytes);
+  }
+
+  // Writes `t` as write(t) does, lending the sink the bytes of `t` it can
+  // refer to in place. Temporaries would be gone by then, so they are refused.
+  template<typename T>
+  void borrow(const T &t)
+  {
+    const bool outer = std::exchange(borrowing_, true);
+    write(t);
+    borrowing_ = outer;
+  }
+
+  template<typename T>
+  void borrow(const T &&) = delete;
+
+  auto operator<<(const auto &t) -> OByteStream &
+  {
+    write(t);
+    return *this;
+  }
+
+ private:
+  template<typename T>
+  void writeFields(const T &t)
+  {
+    static_assert(std::is_aggregate_v<T>, "only aggregates have a portable layout");
+    std::apply([this](const auto &...fields) { (write(fields), ...); }, tieFields(t));
+  }
+
+  void reserve(std::size_t n)
+  {
+    if constexpr (requires { buffer_.reserve(n); }) buffer_.reserve(n);
+  }
+
+  // Bytes of the caller's object, borrowed only inside borrow(t)
+  void lend(ByteSpan bytes)
+  {
+    if (borrowing_)
+      borrow(bytes);
+    else
+      write(bytes);
+  }
+
+  Sink &buffer_;
+  bool borrowing_{false};
+};
+
+// Reading untrusted input
+//
+// IByteStream never reads past the end of its input. A read that runs out of
+// bytes, or meets a malformed encoding, fails the stream: it stops at the
+// end, keeps the first error, and every later read does nothing. A failed
+// read leaves its target valid but unspecified. Bounds are checked once per
+// run of fixed-size fields and once per container of fixed-size elements,
+// so a message of scalars costs a single comparison.
+
+enum class ReadError { Truncated, Malformed, Misaligned };
+
+// Bytes that every `T` takes in `Format`, or 0 if its encoding varies.
+template<typename T, WireFormat Format>
+constexpr auto fixedWireSize() -> std::size_t;
+
+template<WireFormat Format, typename... Ts>
+constexpr auto fixedWireSizeOfAll() -> std::size_t
+{
+  if constexpr (sizeof...(Ts) == 0)
+    return 0;
+  else if constexpr (((fixedWireSize<std::remove_cvref_t<Ts>, Format>() != 0) && ...))
+    return (fixedWireSize<std::remove_cvref_t<Ts>, Format>() + ...);
+  else
+    return 0;
+}
+
+template<typename T, WireFormat Format>
+constexpr auto fixedWireSize() -> std::size_t
+{
+  if constexpr (CopyableAsWire<T, Format> || std::is_scalar_v<T>) {
+    return sizeof(T);
+  } else if constexpr (std::is_array_v<T>) {
+    return std::extent_v<T> * fixedWireSize<std::remove_extent_t<T>, Format>();
+  } else if constexpr (FixedSize<T> && std::ranges::range<T>) {
+    return std::tuple_size_v<T> * fixedWireSize<std::ranges::range_value_t<T>, Format>();
+  } else if constexpr (TupleLike<T>) {
+    return []<std::size_t... I>(std::index_sequence<I...>) {
+      return fixedWireSizeOfAll<Format, std::tuple_element_t<I, T>...>();
+    }(std::make_index_sequence<std::tuple_size_v<T>>{});
+  } else if constexpr (std::is_aggregate_v<T> && !std::ranges::range<T> && !CustomEncoded<T> && Format != WireFormat::Native) {
+    return []<typename... Fields>(std::type_identity<std::tuple<Fields...>>) {
+      return fixedWireSizeOfAll<Format, Fields...>();
+    }(std::type_identity<decltype(tieFields(std::declval<T &>()))>{});
+  } else {
+    return 0;
+  }
+}
+
+// For each of `Ts`, the bytes in the run of consecutive fixed-size types
+// that starts there, or 0 if it does not start such a run.
+template<WireFormat Format, typename... Ts>
+constexpr auto fixedWireRuns() -> std::array<std::size_t, sizeof...(Ts)>
+{
+  constexpr std::array<std::size_t, sizeof...(Ts)> sizes{fixedWireSize<std::remove_cvref_t<Ts>, Format>()...};
+  std::array<std::size_t, sizeof...(Ts)> runs{};
+  for (std::size_t i = sizes.size(); i-- > 0;)
+    if (sizes[i] != 0) runs[i] = sizes[i] + (i + 1 < runs.size() ? runs[i + 1] : 0);
+  for (std::size_t i = 1; i < sizes.size(); ++i)
+    if (sizes[i - 1] != 0) runs[i] = 0;
+  return runs;
+}
+
+// Segmented streams read a sequence of spans, such as the segments of a
+// SegmentedBuffer, as one input. Plain streams leave out the bookkeeping.
+template<WireFormat Format = WireFormat::Native, bool Segmented = false>
+class IByteStream {
+ public:
+  IByteStream(ByteSpan bytes) : begin_(bytes.data()), current_(bytes.data()), end_(bytes.data() + bytes.size()) { }
+
+  IByteStream(ByteBuffer &buf) : IByteStream(buf.bytes()) { }
+
+  // Reads the concatenation of `segments`, which must outlive the stream.
+  IByteStream(std::span<const ByteSpan> segments)
+  requires Segmented
+  {
+    segments_.next = segments.data();
+    segments_.last = segments.data() + segments.size();
+    for (const auto segment : segments) segments_.later += segment.size();
+    nextWindow();
+    begin_ = current_;
+  }
+
+  IByteStream(const SegmentedBuffer &buf)
+  requires Segmented
+      : IByteStream(buf.segments())
+  {
+  }
+
+  // Whether every read so far succeeded.
+  explicit operator bool() const
+  {
+    return !error_;
+  }
+
+  auto error() const -> std::optional<ReadError>
+  {
+    return error_;
+  }
+
+  auto remaining() const -> std::size_t
+  {
+    return window() + later();
+  }
+
+  // Reads `fields` in order and returns whether the stream is still good.
+  // Each run of consecutive fixed-size fields is bounds checked once.
+  template<typename... Ts>
+  requires (sizeof...(Ts) > 0)
+  auto read(Ts &...fields) -> bool
+  {
+    constexpr auto runs = fixedWireRuns<Format, Ts...>();
+    auto refs = std::tie(fields...);
+    bool ok = true;
+    auto one = [&]<std::size_t I>() {
+      auto &field = std::get<I>(refs);
+      if constexpr (fixedWireSize<std::remove_cvref_t<decltype(field)>, Format>() == 0) {
+        get(field);
+      } else {
+        if constexpr (runs[I] != 0) ok = need(runs[I]);
+        if (ok) [[likely]] get(field);
+      }
+    };
+    [&]<std::size_t... I>(std::index_sequence<I...>) { (one.template operator()<I>(), ...); }(std::index_sequence_for<Ts...>{});
+    return !error_;
+  }
+
+  // Reads a `T`, or returns the error that stopped the stream.
+  template<typename T>
+  auto read() -> std::expected<T, ReadError>
+  {
+    T t{};
+    if (!read(t)) return std::unexpected(*error_);
+    return t;
+  }
+
+  // Copies the next bytes into `out`.
+  auto read(MutByteSpan out) -> bool
+  {
+    if constexpr (Segmented)
+      if (out.size() > window()) [[unlikely]] return readAcross(out);
+    if (!need(out.size())) return false;
+
+    std::copy_n(current_, out.size(), out.begin());
+    current_ += out.size();
+    return true;
+  }
+
+  auto operator>>(auto &t) -> IByteStream &
+  {
+    read(t);
+    return *this;
+  }
+
+ private:
+  // Bytes that can be read in place.
+  auto window() const -> std::size_t
+  {
+    return static_cast<std::size_t>(end_ - current_);
+  }
+
+  // Whether the next `n` bytes are there, making them contiguous at
+  // current_; fails the stream if they are not.
+  auto need(std::size_t n) -> bool
+  {
+    if (n <= window()) [[likely]] return true;
+    if constexpr (Segmented) return needAcross(n);
+    fail(ReadError::Truncated);
+    return false;
+  }
+
+  // Bytes after the window, in later segments.
+  auto later() const -> std::size_t
+  {
+    if constexpr (Segmented)
+      return segments_.later;
+    else
+      return 0;
+  }
+
+  auto needAcross(std::size_t n) -> bool
+  {
+    if (n > remaining()) {
+      fail(ReadError::Truncated);
+      return false;
+    }
+    if (current_ == end_) {
+      nextWindow();
+      if (n <= window()) return true;
+    }
+
+    // Stitch the bytes that straddle segments into a buffer of their own
+    auto stitch = std::make_unique_for_overwrite<std::byte[]>(n);
+    auto *out = std::copy(current_, end_, stitch.get());
+    auto &[pending, next, last, later, stitches] = segments_;
+    for (auto left = n - window(); left > 0;) {
+      while (pending.empty()) pending = *next++;
+      const auto k = std::min(left, pending.size());
+      out = std::copy_n(pending.data(), k, out);
+      pending = pending.subspan(k);
+      later -= k;
+      left -= k;
+    }
+    current_ = stitch.get();
+    end_ = current_ + n;
+    stitches.push_back(std::move(stitch));
+    return true;
+  }
+
+  // Moves the window on to the next bytes of a segmented input.
+  void nextWindow()
+  {
+    auto &[pending, next, last, later, stitches] = segments_;
+    while (pending.empty() && next != last) pending = *next++;
+    current_ = pending.data();
+    end_ = current_ + pending.size();
+    later -= pending.size();
+    pending = {};
+  }
+
+  auto readAcross(MutByteSpan out) -> bool
+  {
+    if (out.size() > remaining()) {
+      fail(ReadError::Truncated);
+      return false;
+    }
+    while (!out.empty()) {
+      if (current_ == end_) nextWindow();
+      const auto k = std::min(out.size(), window());
+      std::copy_n(current_, k, out.begin());
+      current_ += k;
+      out = out.subspan(k);
+    }
+    return true;
+  }
+
+  void fail(ReadError e)
+  {
+    if (!error_) error_ = e;
+    current_ = end_;
+    if constexpr (Segmented) {
+      segments_.pending = {};
+      segments_.next = segments_.last;
+      segments_.later = 0;
+    }
+  }
+
+  // The get overloads decode one value. Those of fixed-size types rely on
+  // the caller having checked that the bytes are there; the others check
+  // as they go.
+
+  template<RawCopyable T>
+  void get(T &t)
+  {
+    if constexpr (CopyableAsWire<T, Format>) {
+      std::memcpy(&t, current_, sizeof(T));
+      current_ += sizeof(T);
+    } else if constexpr (std::is_scalar_v<T>) {
+      t = wireOrder<Format>(fromBytesTo<T>({current_, sizeof(T)}));
+      current_ += sizeof(T);
+    } else {
+      getFields(t);
+    }
+  }
+
+  template<Reflectable T>
+  void get(T &t)
+  {
+    if constexpr (Format == WireFormat::Native)
+      forEachFieldRun(t, [this](MutByteSpan run) { read(run); }, [this](auto &field) { read(field); });
+    else
+      getFields(t);
+  }
+
+  template<std::ranges::range C>
+  void get(C &c)
+  {
+    using Element = std::ranges::range_value_t<C>;
+    constexpr auto element_size = fixedWireSize<Element, Format>();
+
+    if constexpr (FixedSize<C>) {
+      if constexpr (BulkCopyable<C, Format> || BulkSwappable<C, Format>)
+        read(std::as_writable_bytes(std::span(c)));
+      else if constexpr (element_size != 0)
+        for (auto &element : c) get(element);
+      else
+        for (auto &element : c) read(element);
+      if constexpr (BulkSwappable<C, Format>)
+        for (auto &element : c) element = wireOrder<Format>(element);
+    } else {
+      std::uint64_t n;
+      if (!need(sizeof(n))) return;
+      get(n);
+      // Every element takes at least a byte, which also bounds the allocation
+      if (n > remaining() / std::max<std::size_t>(element_size, 1)) return fail(ReadError::Truncated);
+
+      if constexpr (BulkCopyable<C, Format> || BulkSwappable<C, Format>) {
+        c.resize(n);
+        read(std::as_writable_bytes(std::span(std::ranges::data(c), n)));
+        if constexpr (BulkSwappable<C, Format>)
+          for (auto &element : c) element = wireOrder<Format>(element);
+      } else if constexpr (std::ranges::contiguous_range<C>) {
+        c.resize(n);
+        for (auto &element : c) {
+          if constexpr (element_size == 0) {
+            if (!read(element)) return;
+          } else {
+            // Segmented streams stitch only the elements that straddle segments
+            if (Segmented && !need(element_size)) return;
+            get(element);
+          }
+        }
+      } else {
+        c.clear();
+        for (std::uint64_t i = 0; i < n; ++i) {
+          typename ReadElement<Element>::type element{};
+          if constexpr (element_size == 0) {
+            if (!read(element)) return;
+          } else {
+            // Segmented streams stitch only the elements that straddle segments
+            if (Segmented && !need(element_size)) return;
+            get(element);
+          }
+          c.insert(c.end(), std::move(element));
+        }
+      }
+    }
+  }
+
+  template<std::integral T>
+  void get(Varint<T> &v)
+  {
+    std::uint64_t u;
+    auto n = decodeVarint(current_, end_, u);
+    // A varint may straddle segments
+    if (n == 0 && later() != 0 && need(std::min(max_varint_bytes, remaining()))) n = decodeVarint(current_, end_, u);
+    if (n == 0) [[unlikely]]
+      return fail(remaining() < max_varint_bytes ? ReadError::Truncated : ReadError::Malformed);
+
+    // A value that does not fit was not written as a Varint<T>
+    using Wide = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+    const auto wide = zigzagDecode<Wide>(u);
+    if (static_cast<Wide>(static_cast<T>(wide)) != wide) [[unlikely]]
+      return fail(ReadError::Malformed);
+
+    v.value = static_cast<T>(wide);
+    current_ += n;
+  }
+
+  void get(GroupVarints &g)
+  {
+    Varint<std::size_t> count;
+    get(count);
+    // Every group of four takes at least five bytes
+    if (!error_ && count > remaining() / 5 * 4) fail(ReadError::Truncated);
+    if (error_) return;
+
+    auto &values = g.values;
+    values.resize(count);
+    std::size_t i = 0;
+    for (; i + 4 <= values.size(); i += 4) {
+      if ((current_ == end_ && !need(1)) || !need(groupVarintSize(*current_))) return;
+      current_ += decodeGroupVarint(current_, end_, values.data() + i);
+    }
+    if (i < values.size()) {
+      if ((current_ == end_ && !need(1)) || !need(groupVarintSize(*current_))) return;
+      std::array<std::uint32_t, 4> last;
+      current_ += decodeGroupVarint(current_, end_, last.data());
+      std::copy_n(last.begin(), values.size() - i, values.begin() + i);
+    }
+  }
+
+  template<TupleLike T>
+  void get(T &t)
+  {
+    if constexpr (fixedWireSize<T, Format>() != 0)
+      std::apply([this](auto &...elements) { (get(elements), ...); }, t);
+    else
+      std::apply([this](auto &...elements) { read(elements...); }, t);
+  }
+
+  template<typename T>
+  void get(std::optional<T> &o)
+  {
+    bool present;
+    if (!need(sizeof(present))) return;
+    get(present);
+    if (present)
+      read(o.emplace());
+    else
+      o.reset();
+  }
+
+  // Strings and spans are read in place, pointing into the input.
+  template<typename C>
+  void get(std::basic_string_view<C> &s)
+  {
+    static_assert(sizeof(C) == 1 || CopyableAsWire<C, Format>, "wide characters need byte swapping; read a std::basic_string instead");
+    std::size_t n;
+    if (const auto *p = getInPlace<C>(n)) s = {p, n};
+  }
+
+  template<typename T>
+  void get(std::span<const T> &s)
+  {
+    static_assert(CopyableAsWire<T, Format>, "elements need decoding; read an ArrayView instead");
+    std::size_t n;
+    if (const auto *p = getInPlace<T>(n)) s = {p, n};
+  }
+
+  template<typename T>
+  void get(View<T, Format> &v)
+  {
+    constexpr auto size = fixedWireSize<T, Format>();
+    if (!need(size)) return;
+    v = View<T, Format>(ByteSpan(current_, size));
+    current_ += size;
+  }
+
+  template<typename T>
+  void get(ArrayView<T, Format> &a)
+  {
+    constexpr auto size = fixedWireSize<T, Format>();
+    std::uint64_t n;
+    if (!need(sizeof(n))) return;
+    get(n);
+    if (n > remaining() / size) return fail(ReadError::Truncated);
+    if (!need(n * size)) return;
+    a = ArrayView<T, Format>(ByteSpan(current_, n * size));
+    current_ += n * size;
+  }
+
+  // Reads a count and returns where that many `T` start in the input, or
+  // nullptr if they are not all there or not aligned for `T`.
+  template<typename T>
+  auto getInPlace(std::size_t &n) -> const T *
+  {
+    std::uint64_t count;
+    if (!need(sizeof(count))) return nullptr;
+    get(count);
+    if (count > remaining() / sizeof(T)) {
+      fail(ReadError::Truncated);
+      return nullptr;
+    }
+    if (!need(count * sizeof(T))) return nullptr;
+    if (reinterpret_cast<std::uintptr_t>(current_) % alignof(T) != 0) {
+      fail(ReadError::Misaligned);
+      return nullptr;
+    }
+
+    const auto *p = reinterpret_cast<const T *>(current_);
+    n = count;
+    current_ += count * sizeof(T);
+    return p;
+  }
+
+  template<typename T>
+  void getFields(T &t)
+  {
+    static_assert(std::is_aggregate_v<T>, "only aggregates have a portable layout");
+    if constexpr (fixedWireSize<T, Format>() != 0)
+      std::apply([this](auto &...fields) { (get(fields), ...); }, tieFields(t));
+    else
+      std::apply([this](auto &...fields) { read(fields...); }, tieFields(t));
+  }
+
+  const std::byte *begin_{nullptr};
+  const std::byte *current_{nullptr};
+  const std::byte *end_{nullptr};
+  std::optional<ReadError> error_;
+
+  // The input after the window: the rest of the segment the window was
+  // stitched from, then the later segments
+  struct Segments {
+    ByteSpan pending;
+    const ByteSpan *next{nullptr};
+    const ByteSpan *last{nullptr};
+    std::size_t later{0};
+    std::vector<std::unique_ptr<std::byte[]>> stitches;
+  };
+  struct NoSegments { };
+  [[no_unique_address]] std::conditional_t<Segmented, Segments, NoSegments> segments_;
+};
+
+IByteStream(std::span<const ByteSpan>) -> IByteStream<WireFormat::Native, true>;
+IByteStream(const SegmentedBuffer &) -> IByteStream<WireFormat::Native, true>;
+
+// Zero-copy views
+//
+// Reading into a std::string_view or std::span<const T> points it into the
+// input instead of copying; spans need the elements to be stored as they
+// are in memory and aligned for T in the input. View<T> holds the encoding
+// of a fixed-size T and decodes single fields on demand, and ArrayView<T>
+// does the same for a container of them. All of them refer to the input,
+// which must outlive them.
+
+template<typename T, WireFormat Format>
+class View {
+ public:
+  using wire_encoding = void;
+
+  static_assert(fixedWireSize<T, Format>() != 0, "only fixed-size types can be viewed");
+
+  template<std::size_t I>
+  using FieldType = std::remove_cvref_t<std::tuple_element_t<I, decltype(tieFields(std::declval<T &>()))>>;
+
+  View() = default;
+
+  explicit View(ByteSpan bytes) : bytes_(bytes)
+  {
+    assert((bytes.size() == fixedWireSize<T, Format>()));
+  }
+
+  auto bytes() const -> ByteSpan
+  {
+    return bytes_;
+  }
+
+  // Decodes the whole value.
+  auto load() const -> T
+  {
+    return decode<T>(bytes_);
+  }
+
+  // Decodes field `I` alone.
+  template<std::size_t I>
+  auto get() const -> FieldType<I>
+  {
+    return decode<FieldType<I>>(fieldBytes<I>());
+  }
+
+  // Views field `I` without decoding it.
+  template<std::size_t I>
+  auto field() const -> View<FieldType<I>, Format>
+  {
+    return View<FieldType<I>, Format>(fieldBytes<I>());
+  }
+
+ private:
+  template<typename U>
+  static auto decode(ByteSpan bytes) -> U
+  {
+    U u{};
+    IByteStream<Format>(bytes) >> u;
+    return u;
+  }
+
+  template<std::size_t I>
+  auto fieldBytes() const -> ByteSpan
+  {
+    return bytes_.subspan(fieldOffset<I>(), fixedWireSize<FieldType<I>, Format>());
+  }
+
+  static constexpr std::size_t field_count = std::tuple_size_v<decltype(tieFields(std::declval<T &>()))>;
+
+  // Offsets of every field and, last, of the end of T. Native encodings are
+  // the memory layout, so each field starts at the end of the one before
+  // rounded up to its alignment and T ends rounded up to its own; the other
+  // formats pack the fields back to back.
+  static constexpr auto field_offsets = []<std::size_t... J>(std::index_sequence<J...>) {
+    std::array<std::size_t, field_count + 1> offsets{};
+    std::size_t offset = 0;
+    if constexpr (Format == WireFormat::Native) {
+      const auto align = [](std::size_t n, std::size_t a) { return (n + a - 1) / a * a; };
+      ((offsets[J] = align(offset, alignof(FieldType<J>)), offset = offsets[J] + sizeof(FieldType<J>)), ...);
+      offsets[field_count] = align(offset, alignof(T));
+    } else {
+      ((offsets[J] = offset, offset += fixedWireSize<FieldType<J>, Format>()), ...);
+      offsets[field_count] = offset;
+    }
+    return offsets;
+  }(std::make_index_sequence<field_count>{});
+
+  // Catches fields whose alignment is not their type's, e.g. alignas on a
+  // member, which the arithmetic above cannot see.
+  static_assert(field_offsets[field_count] == fixedWireSize<T, Format>(), "fields are not laid out by their types");
+
+  template<std::size_t I>
+  static constexpr auto fieldOffset() -> std::size_t
+  {
+    return field_offsets[I];
+  }
+
+  ByteSpan bytes_;
+};
+
+template<typename T, WireFormat Format>
+class ArrayView {
+ public:
+  using wire_encoding = void;
+
+  ArrayView() = default;
+
+  explicit ArrayView(ByteSpan bytes) : bytes_(bytes)
+  {
+    assert(bytes.size() % element_size == 0);
+  }
+
+  auto bytes() const -> ByteSpan
+  {
+    return bytes_;
+  }
+
+  auto size() const -> std::size_t
+  {
+    return bytes_.size() / element_size;
+  }
+
+  auto operator[](std::size_t i) const -> View<T, Format>
+  {
+    return View<T, Format>(bytes_.subspan(i * element_size, element_size));
+  }
+
+ private:
+  static constexpr auto element_size = fixedWireSize<T, Format>();
+
+  ByteSpan bytes_;
+};
+
+// Asynchronous file I/O
+//
+// IoQueue runs reads and writes in the background: on an io_uring when the
+// kernel provides one, otherwise on a small pool of threads doing pread and
+// pwrite. AsyncSink double-buffers stream output, submitting each full
+// buffer and going on with the other, so a producer only waits when the
+// disk falls a whole buffer behind. AsyncSource reads the next block of a
+// file while the current one is decoded.
+
+struct IoRequest {
+  bool write;
+  int fd;
+  std::byte *data;
+  std::size_t size;
+  std::uint64_t offset;
+  std::uint64_t tag;
+};
+
+struct IoCompletion {
+  std::uint64_t tag;
+  // Bytes transferred, or -errno
+  std::int64_t result;
+};
+
+enum class IoBackend { Ring, Threads };
+
+class IoQueue {
+ public:
+  explicit IoQueue(IoBackend backend = IoBackend::Ring, unsigned threads = 2)
+  {
+    if (backend == IoBackend::Ring && setupRing()) return;
+    for (unsigned i = 0; i < threads; ++i) workers_.emplace_back([this] { work(); });
+  }
+
+  IoQueue(const IoQueue &) = delete;
+  auto operator=(const IoQueue &) -> IoQueue & = delete;
+
+  ~IoQueue()
+  {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    pending_cv_.notify_all();
+    for (auto &worker : workers_) worker.join();
+#if defined(__linux__)
+    if (ring_fd_ >= 0) {
+      ::munmap(sqes_, sqes_size_);
+      if (cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_size_);
+      ::munmap(sq_ring_, sq_ring_size_);
+      ::close(ring_fd_);
+    }
+#endif
+  }
+
+  auto backend() const -> IoBackend
+  {
+    return workers_.empty() ? IoBackend::Ring : IoBackend::Threads;
+  }
+
+  // Starts `request` without waiting for it. Writes always complete in full
+  // or fail; reads may come back short at the end of the file. Should the
+  // ring itself fail, every request still on it fails with its errno.
+  void submit(const IoRequest &request)
+  {
+#if defined(__linux__)
+    if (ring_fd_ >= 0) {
+      inflight_.push_back({request, 0});
+      queued_.push_back(request);
+      pump(false);
+      return;
+    }
+#endif
+    {
+      std::lock_guard lock(mutex_);
+      pending_.push_back(request);
+    }
+    pending_cv_.notify_one();
+  }
+
+  // Waits for the next request to finish, in any order.
+  auto wait() -> IoCompletion
+  {
+#if defined(__linux__)
+    if (ring_fd_ >= 0) return waitForRing();
+#endif
+    std::unique_lock lock(mutex_);
+    done_cv_.wait(lock, [this] { return !done_.empty(); });
+    const auto completion = done_.front();
+    done_.pop_front();
+    return completion;
+  }
+
+ private:
+  void work()
+  {
+    for (;;) {
+      IoRequest request;
+      {
+        std::unique_lock lock(mutex_);
+        pending_cv_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+        if (pending_.empty()) return;
+        request = pending_.front();
+        pending_.pop_front();
+      }
+
+      std::int64_t done = 0;
+      while (static_cast<std::size_t>(done) < request.size) {
+        const auto n = request.write ? ::pwrite(request.fd, request.data + done, request.size - done, request.offset + done)
+                                     : ::pread(request.fd, request.data + done, request.size - done, request.offset + done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) done = -errno;
+        // A write that makes no progress would never finish
+        if (n == 0 && request.write) done = -EIO;
+        if (n <= 0) break;
+        done += n;
+      }
+
+      {
+        std::lock_guard lock(mutex_);
+        done_.push_back({request.tag, done});
+      }
+      done_cv_.notify_one();
+    }
+  }
+
+#if defined(__linux__)
+  auto setupRing() -> bool
+  {
+    io_uring_params params{};
+    ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, 8, &params));
+    if (ring_fd_ < 0) return false;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+
+    auto map = [this](std::size_t size, off_t offset) {
+      void *p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, offset);
+      return p == MAP_FAILED ? nullptr : p;
+    };
+    sq_ring_ = map(sq_ring_size_, IORING_OFF_SQ_RING);
+    cq_ring_ = single_mmap ? sq_ring_ : map(cq_ring_size_, IORING_OFF_CQ_RING);
+    sqes_ = static_cast<io_uring_sqe *>(map(sqes_size_, IORING_OFF_SQES));
+    if (sq_ring_ == nullptr || cq_ring_ == nullptr || sqes_ == nullptr) {
+      if (sqes_ != nullptr) ::munmap(sqes_, sqes_size_);
+      if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_size_);
+      if (sq_ring_ != nullptr) ::munmap(sq_ring_, sq_ring_size_);
+      ::close(ring_fd_);
+      ring_fd_ = -1;
+      return false;
+    }
+
+    auto *sq = static_cast<std::byte *>(sq_ring_);
+    auto *cq = static_cast<std::byte *>(cq_ring_);
+    sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_entries_ = params.sq_entries;
+    sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+    return true;
+  }
+
+  // Moves queued requests into free submission entries and hands them to
+  // the kernel, then collects finished requests into done_, first waiting
+  // for one if `wait` is set or some requests found no free entry. Requests
+  // the kernel cannot take fail.
+  void pump(bool wait)
+  {
+    auto tail = *sq_tail_;
+    for (; !queued_.empty() && tail - sqHead() < sq_entries_; queued_.pop_front()) {
+      const auto &request = queued_.front();
+      auto &sqe = sqes_[tail & sq_mask_];
+      sqe = {};
+      sqe.opcode = request.write ? IORING_OP_WRITE : IORING_OP_READ;
+      sqe.fd = request.fd;
+      sqe.addr = reinterpret_cast<std::uint64_t>(request.data);
+      // Larger requests come back short and go on from where they stopped
+      sqe.len = static_cast<std::uint32_t>(std::min(request.size, max_ring_size));
+      sqe.off = request.offset;
+      sqe.user_data = request.tag;
+      sq_array_[tail & sq_mask_] = tail & sq_mask_;
+      ++tail;
+    }
+    std::atomic_ref(*sq_tail_).store(tail, std::memory_order_release);
+
+    int error = tail != sqHead() ? enter(tail - sqHead(), 0) : 0;
+    // Without SQPOLL the kernel only takes entries inside io_uring_enter, so
+    // those it left can be withdrawn
+    const auto unsubmitted = tail - sqHead() + queued_.size();
+    const bool in_kernel = inflight_.size() > unsubmitted;
+    if (error == EAGAIN || error == EBUSY) error = in_kernel ? 0 : error;
+    if (error == 0 && (wait || unsubmitted > 0) && in_kernel && cqEmpty()) error = enter(0, 1);
+    if (error != 0) {
+      std::atomic_ref(*sq_tail_).store(sqHead(), std::memory_order_release);
+      queued_.clear();
+      // Requests the kernel holds can no longer be waited for either
+      for (const auto &[request, done] : inflight_) done_.push_back({request.tag, -error});
+      inflight_.clear();
+      return;
+    }
+    reap();
+  }
+
+  // Returns 0 or the errno of io_uring_enter, retrying on signals.
+  auto enter(unsigned to_submit, unsigned min_complete) -> int
+  {
+    const unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete, flags, nullptr, 0) < 0) {
+      if (errno != EINTR) return errno;
+    }
+    return 0;
+  }
+
+  // Moves completions to done_, queueing the rest of short requests again.
+  void reap()
+  {
+    for (auto head = *cq_head_; head != std::atomic_ref(*cq_tail_).load(std::memory_order_acquire); ++head) {
+      const auto cqe = cqes_[head & cq_mask_];
+      std::atomic_ref(*cq_head_).store(head + 1, std::memory_order_release);
+
+      auto it = std::ranges::find(inflight_, cqe.user_data, [](const auto &op) { return op.first.tag; });
+      assert(it != inflight_.end());
+      auto &[request, done] = *it;
+      if (cqe.res > 0) done += static_cast<std::size_t>(cqe.res);
+      if (cqe.res > 0 && done < request.size) {
+        queued_.push_back({request.write, request.fd, request.data + done, request.size - done, request.offset + done, request.tag});
+        continue;
+      }
+      // A write that makes no progress would never finish
+      const auto result = cqe.res < 0                          ? cqe.res
+                          : request.write && done < request.size ? -EIO
+                                                                  : static_cast<std::int64_t>(done);
+      done_.push_back({request.tag, result});
+      inflight_.erase(it);
+    }
+  }
+
+  auto waitForRing() -> IoCompletion
+  {
+    while (done_.empty()) {
+      assert(!inflight_.empty());
+      pump(true);
+    }
+    const auto completion = done_.front();
+    done_.pop_front();
+    return completion;
+  }
+
+  auto sqHead() const -> unsigned
+  {
+    return std::atomic_ref(*sq_head_).load(std::memory_order_acquire);
+  }
+
+  auto cqEmpty() const -> bool
+  {
+    return *cq_head_ == std::atomic_ref(*cq_tail_).load(std::memory_order_acquire);
+  }
+
+  static constexpr std::size_t max_ring_size = 1 << 30;
+
+  int ring_fd_{-1};
+  void *sq_ring_{nullptr};
+  void *cq_ring_{nullptr};
+  io_uring_sqe *sqes_{nullptr};
+  std::size_t sq_ring_size_{0};
+  std::size_t cq_ring_size_{0};
+  std::size_t sqes_size_{0};
+  unsigned *sq_head_{nullptr};
+  unsigned *sq_tail_{nullptr};
+  unsigned *sq_array_{nullptr};
+  unsigned sq_mask_{0};
+  unsigned sq_entries_{0};
+  unsigned *cq_head_{nullptr};
+  unsigned *cq_tail_{nullptr};
+  unsigned cq_mask_{0};
+  io_uring_cqe *cqes_{nullptr};
+  // Requests on the ring, with the bytes transferred so far
+  std::vector<std::pair<IoRequest, std::size_t>> inflight_;
+  // What is left of requests waiting for a submission entry
+  std::deque<IoRequest> queued_;
+#else
+  auto setupRing() -> bool
+  {
+    return false;
+  }
+#endif
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable pending_cv_;
+  std::condition_variable done_cv_;
+  std::deque<IoRequest> pending_;
+  // Finished requests; the ring fills it without the lock
+  std::deque<IoCompletion> done_;
+  bool stopping_{false};
+};
+
+// A sink writing to `fd` from `offset` on through two buffers of
+// `buffer_size` bytes.
+class AsyncSink {
+ public:
+  explicit AsyncSink(int fd, std::uint64_t offset = 0, std::size_t buffer_size = 1 << 20, IoBackend backend = IoBackend::Ring)
+      : fd_(fd), offset_(offset), buffer_size_(buffer_size), io_(backend), buffers_{ByteBuffer(buffer_size), ByteBuffer(buffer_size)}
+  {
+  }
+
+  AsyncSink(const AsyncSink &) = delete;
+  auto operator=(const AsyncSink &) -> AsyncSink & = delete;
+
+  ~AsyncSink()
+  {
+    flush();
+  }
+
+  auto backend() const -> IoBackend
+  {
+    return io_.backend();
+  }
+
+  // The file offset after everything written so far.
+  auto offset() const -> std::uint64_t
+  {
+    return offset_ + buffers_[front_].size();
+  }
+
+  // The errno of the first write that failed, or 0.
+  auto ioError() const -> int
+  {
+    return io_error_;
+  }
+
+  void reserve(std::size_t extra)
+  {
+    buffers_[front_].reserve(extra);
+  }
+
+  std::size_t write(ByteSpan bytes)
+  {
+    buffers_[front_].write(bytes);
+    if (buffers_[front_].size() >= buffer_size_) submitFront();
+    return bytes.size();
+  }
+
+  // Writes out whatever is buffered and waits for all writes to finish.
+  // Returns false if any of them failed.
+  auto flush() -> bool
+  {
+    if (buffers_[front_].size() != 0) submitFront();
+    finish(0);
+    finish(1);
+    return io_error_ == 0;
+  }
+
+ private:
+  // Hands the front buffer to the queue and switches to the other one,
+  // waiting first for its own write if that is still running.
+  void submitFront()
+  {
+    auto &buffer = buffers_[front_];
+    io_.submit({true, fd_, const_cast<std::byte *>(buffer.bytes().data()), buffer.size(), offset_, front_});
+    offset_ += buffer.size();
+    busy_[front_] = true;
+
+    front_ ^= 1;
+    finish(front_);
+    buffers_[front_].clear();
+  }
+
+  void finish(std::size_t i)
+  {
+    while (busy_[i]) {
+      const auto completion = io_.wait();
+      busy_[completion.tag] = false;
+      const auto size = static_cast<std::int64_t>(buffers_[completion.tag].size());
+      if (completion.result != size && io_error_ == 0) io_error_ = completion.result < 0 ? static_cast<int>(-completion.result) : EIO;
+    }
+  }
+
+  int fd_;
+  std::uint64_t offset_;
+  std::size_t buffer_size_;
+  IoQueue io_;
+  std::array<ByteBuffer, 2> buffers_;
+  std::array<bool, 2> busy_{};
+  std::size_t front_{0};
+  int io_error_{0};
+};
+
+// A source reading `fd` from `offset` on in blocks of `block_size` bytes,
+// one block ahead of the decoder. A value may straddle blocks but must fit
+// in one.
+class AsyncSource {
+ public:
+  explicit AsyncSource(int fd, std::uint64_t offset = 0, std::size_t block_size = 1 << 20, IoBackend backend = IoBackend::Ring)
+      : fd_(fd), offset_(offset), block_size_(block_size), io_(backend)
+  {
+    // Each buffer holds the unread tail of the previous block, then a block
+    for (auto &buffer : buffers_) buffer = std::make_unique_for_overwrite<std::byte[]>(2 * block_size);
+    readAhead();
+  }
+
+  AsyncSource(const AsyncSource &) = delete;
+  auto operator=(const AsyncSource &) -> AsyncSource & = delete;
+
+  ~AsyncSource()
+  {
+    if (reading_) io_.wait();
+  }
+
+  auto backend() const -> IoBackend
+  {
+    return io_.backend();
+  }
+
+  // Why reading stopped before the end of the file, if it did.
+  auto error() const -> std::optional<ReadError>
+  {
+    return error_;
+  }
+
+  // The errno of a read that failed, or 0.
+  auto ioError() const -> int
+  {
+    return io_error_;
+  }
+
+  // Decodes the next `t`. Returns false at the end of the file or on an
+  // error.
+  template<WireFormat Format = WireFormat::Native, typename T>
+  auto read(T &t) -> bool
+  {
+    for (;;) {
+      IByteStream<Format> in{window_};
+      if (in.read(t)) {
+        window_ = window_.last(in.remaining());
+        return true;
+      }
+      if (*in.error() != ReadError::Truncated) {
+        error_ = in.error();
+        return false;
+      }
+      if (!refill()) {
+        if (!window_.empty() || io_error_ != 0) error_ = ReadError::Truncated;
+        return false;
+      }
+    }
+  }
+
+ private:
+  // Submits a read of the next block into the buffer not being decoded.
+  void readAhead()
+  {
+    io_.submit({false, fd_, buffers_[1 - current_].get() + block_size_, block_size_, offset_, 0});
+    reading_ = true;
+  }
+
+  // Appends the block read ahead to what is left of the window.
+  auto refill() -> bool
+  {
+    if (!reading_ || window_.size() > block_size_) return false;
+    const auto completion = io_.wait();
+    reading_ = false;
+    if (completion.result <= 0) {
+      io_error_ = static_cast<int>(-completion.result);
+      return false;
+    }
+
+    auto *block = buffers_[1 - current_].get() + block_size_;
+    std::copy(window_.begin(), window_.end(), block - window_.size());
+    window_ = ByteSpan(block - window_.size(), window_.size() + static_cast<std::size_t>(completion.result));
+    offset_ += static_cast<std::uint64_t>(completion.result);
+    current_ ^= 1;
+    readAhead();
+    return true;
+  }
+
+  int fd_;
+  std::uint64_t offset_;
+  std::size_t block_size_;
+  IoQueue io_;
+  std::array<std::unique_ptr<std::byte[]>, 2> buffers_;
+  std::size_t current_{0};
+  ByteSpan window_;
+  bool reading_{false};
+  std::optional<ReadError> error_;
+  int io_error_{0};
+};
+
+// JSON strings
+
+inline auto charBytes(std::string_view str lifetimebound) -> ByteSpan
+{
+  return std::as_bytes(std::span(str.data(), str.size()));
+}
+
+// Appends the UTF-8 encoding of `cp` to `out`.
+inline void writeUtf8(char32_t cp, ByteBuffer &out)
+{
+  char buf[4];
+  std::size_t len;
+  if (cp < 0x80) {
+    buf[0] = static_cast<char>(cp);
+    len = 1;
+  } else if (cp < 0x800) {
+    buf[0] = static_cast<char>(0xc0 | (cp >> 6));
+    buf[1] = static_cast<char>(0x80 | (cp & 0x3f));
+    len = 2;
+  } else if (cp < 0x10000) {
+    buf[0] = static_cast<char>(0xe0 | (cp >> 12));
+    buf[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+    buf[2] = static_cast<char>(0x80 | (cp & 0x3f));
+    len = 3;
+  } else {
+    buf[0] = static_cast<char>(0xf0 | (cp >> 18));
+    buf[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+    buf[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+    buf[3] = static_cast<char>(0x80 | (cp & 0x3f));
+    len = 4;
+  }
+  out.write(charBytes({buf, len}));
+}
+
+constexpr auto isJsonSpecial(char c) -> bool
+{
+  return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+}
+
+// Returns a mask with bit i set when p[i] is '"', '\\' or a control
+// character, for the 16 bytes at p.
+inline auto jsonSpecial16(const char *p) -> uint32_t
+{
+#if defined(__SSE2__)
+  const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  const auto quote = _mm_cmpeq_epi8(v, _mm_set1_epi8('"'));
+  const auto backslash = _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'));
+  // Unsigned v < 0x20 exactly when min(v, 0x1f) == v
+  const auto control = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x1f)), v);
+  return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(quote, backslash), control));
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < 16; ++i) mask |= uint32_t{isJsonSpecial(p[i])} << i;
+  return mask;
+#endif
+}
+
+// Returns the offset of the first byte at or after `from` that a JSON string
+// cannot hold unescaped, or str.size().
+inline auto findJsonSpecial(std::string_view str, std::size_t from) -> std::size_t
+{
+  for (; from + 16 <= str.size(); from += 16) {
+    if (const auto mask = jsonSpecial16(str.data() + from)) return from + std::countr_zero(mask);
+  }
+  while (from < str.size() && !isJsonSpecial(str[from])) ++from;
+  return from;
+}
+
+// Appends `str` to `out` as a quoted JSON string. Runs that need no escaping
+// are copied in bulk; UTF-8 passes through unchanged.
+void jsonEscape(std::string_view str, ByteBuffer &out)
+{
+  static constexpr char hex[] = "0123456789abcdef";
+
+  out.write(charBytes("\""));
+  for (std::size_t i = 0;;) {
+    const auto special = findJsonSpecial(str, i);
+    out.write(charBytes(str.substr(i, special - i)));
+    if (special == str.size()) break;
+
+    const auto c = static_cast<unsigned char>(str[special]);
+    char escape[6] = {'\\', static_cast<char>(c), '0', '0', '0', '0'};
+    std::size_t len = 2;
+    switch (c) {
+      case '"':
+      case '\\':
+        break;
+      case '\b':
+        escape[1] = 'b';
+        break;
+      case '\f':
+        escape[1] = 'f';
+        break;
+      case '\n':
+        escape[1] = 'n';
+        break;
+      case '\r':
+        escape[1] = 'r';
+        break;
+      case '\t':
+        escape[1] = 't';
+        break;
+      default:
+        escape[1] = 'u';
+        escape[4] = hex[c >> 4];
+        escape[5] = hex[c & 0xf];
+        len = 6;
+    }
+    out.write(charBytes({escape, len}));
+    i = special + 1;
+  }
+  out.write(charBytes("\""));
+}
+
+// Parses the four hex digits of a \u escape at `str[at]`.
+constexpr auto parseHex4(std::string_view str, std::size_t at) -> std::optional<char32_t>
+{
+  if (at + 4 > str.size()) return std::nullopt;
+
+  char32_t value = 0;
+  for (const char c : str.substr(at, 4)) {
+    char32_t digit;
+    if (c >= '0' && c <= '9')
+      digit = c - '0';
+    else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+      digit = (c | 0x20) - 'a' + 10;
+    else
+      return std::nullopt;
+    value = value << 4 | digit;
+  }
+  return value;
+}
+
+// Decodes a JSON string body, starting just after its opening quote, into
+// `out` as UTF-8. Returns the offset just past the closing quote, or nullopt
+// if the string is unterminated or holds a raw control character or an
+// invalid escape. Unpaired surrogates decode to U+FFFD.
+auto jsonUnescape(std::string_view str, ByteBuffer &out) -> std::optional<std::size_t>
+{
+  for (std::size_t i = 0;;) {
+    const auto special = findJsonSpecial(str, i);
+    out.write(charBytes(str.substr(i, special - i)));
+    if (special == str.size() || static_cast<unsigned char>(str[special]) < 0x20) return std::nullopt;
+    if (str[special] == '"') return special + 1;
+
+    if (special + 1 == str.size()) return std::nullopt;
+    i = special + 2;
+    switch (str[special + 1]) {
+      case '"':
+      case '\\':
+      case '/':
+        out.write(charBytes(str.substr(special + 1, 1)));
+        break;
+      case 'b':
+        out.write(charBytes("\b"));
+        break;
+      case 'f':
+        out.write(charBytes("\f"));
+        break;
+      case 'n':
+        out.write(charBytes("\n"));
+        break;
+      case 'r':
+        out.write(charBytes("\r"));
+        break;
+      case 't':
+        out.write(charBytes("\t"));
+        break;
+      case 'u': {
+        auto cp = parseHex4(str, i);
+        if (!cp) return std::nullopt;
+        i += 4;
+        if (*cp >= 0xd800 && *cp <= 0xdbff) {
+          // A high surrogate must be followed by an escaped low surrogate
+          const auto low = str.substr(i, 2) == "\\u" ? parseHex4(str, i + 2) : std::nullopt;
+          if (low && *low >= 0xdc00 && *low <= 0xdfff) {
+            cp = 0x10000 + ((*cp - 0xd800) << 10) + (*low - 0xdc00);
+            i += 6;
+          } else {
+            cp = U'�';
+          }
+        } else if (*cp >= 0xdc00 && *cp <= 0xdfff) {
+          cp = U'�';
+        }
+        writeUtf8(*cp, out);
+        break;
+      }
+      default:
+        return std::nullopt;
+    }
+  }
+}
+
+// Runs `f` a few times and returns its best time and its result.
+template<typename F>
+auto bestOf(F &f)
+{
+  using namespace std::chrono;
+  auto best = duration<double>::max();
+  auto result = f();
+  for (int run = 0; run < 3; ++run) {
+    const auto begin = steady_clock::now();
+    result = f();
+    best = std::min<duration<double>>(best, steady_clock::now() - begin);
+  }
+  return std::pair{best, result};
+}
+
+// Times `f` over `bytes` bytes of input, keeping the best of a few runs,
+// and reports its throughput.
+template<typename F>
+void bench(std::string_view name, std::size_t bytes, F &&f)
+{
+  const auto [best, result] = bestOf(f);
+  std::println("{:<32} {:8.3f} GB/s  (result: {})", name, bytes / best.count() / 1e9, result);
+}
+
+// Times `f` over `records` records and reports how many it handles per
+// second.
+template<typename F>
+void benchRecords(std::string_view name, std::size_t records, F &&f)
+{
+  const auto [best, result] = bestOf(f);
+  std::println("{:<32} {:8.3f} Mrec/s (result: {})", name, records / best.count() / 1e6, result);
+}
+
+// Compares the bulk container paths against writing and reading one
+// element at a time.
+void benchContainers()
+{
+  std::vector<std::uint32_t> numbers(4 << 20);
+  for (std::size_t i = 0; i < numbers.size(); ++i) numbers[i] = static_cast<std::uint32_t>(i * 2654435761U);
+  const auto bytes = numbers.size() * sizeof(std::uint32_t);
+
+  ByteBuffer buf(bytes + 64);
+  bench("write vector<u32> (bulk)", bytes, [&] {
+    buf.clear();
+    OByteStream{buf} << numbers;
+    return buf.size();
+  });
+  bench("write vector<u32> (per element)", bytes, [&] {
+    buf.clear();
+    OByteStream out{buf};
+    out << static_cast<std::uint64_t>(numbers.size());
+    for (const auto n : numbers) out << n;
+    return buf.size();
+  });
+
+  std::vector<std::uint32_t> read_back;
+  bench("read vector<u32> (bulk)", bytes, [&] {
+    IByteStream{buf} >> read_back;
+    return read_back.size();
+  });
+  bench("read vector<u32> (per element)", bytes, [&] {
+    IByteStream in{buf};
+    std::uint64_t n = 0;
+    in >> n;
+    read_back.clear();
+    for (std::uint64_t i = 0; i < n; ++i) {
+      std::uint32_t x = 0;
+      in >> x;
+      read_back.push_back(x);
+    }
+    return read_back.size();
+  });
+
+  ByteBuffer big(bytes + 64);
+  bench("write vector<u32> (big endian)", bytes, [&] {
+    big.clear();
+    OByteStream<WireFormat::Big>{big} << numbers;
+    return big.size();
+  });
+  bench("read vector<u32> (big endian)", bytes, [&] {
+    IByteStream<WireFormat::Big>{big} >> read_back;
+    return read_back.size();
+  });
+
+  std::vector<std::string> words(1 << 18);
+  for (std::size_t i = 0; i < words.size(); ++i) words[i] = std::format("word-{}", i);
+  buf.clear();
+  OByteStream{buf} << words;
+  const auto word_bytes = buf.size();
+  bench("write vector<string>", word_bytes, [&] {
+    buf.clear();
+    OByteStream{buf} << words;
+    return buf.size();
+  });
+  std::vector<std::string> words_back;
+  bench("read vector<string>", word_bytes, [&] {
+    IByteStream{buf} >> words_back;
+    return words_back.size();
+  });
+}
+
+// Compares fixed-width, varint and group-varint encodings of mostly small
+// values.
+void benchIntegers()
+{
+  std::vector<std::uint32_t> values(4 << 20);
+  std::uint32_t state = 1;
+  for (auto &v : values) {
+    state = state * 1664525 + 1013904223;
+    v = (state >> 8) >> (state % 24);
+  }
+  const auto bytes = values.size() * sizeof(std::uint32_t);
+
+  ByteBuffer fixed(bytes + 64), leb(bytes + 64), group(bytes + 64);
+  bench("write fixed u32", bytes, [&] {
+    fixed.clear();
+    OByteStream{fixed} << values;
+    return fixed.size();
+  });
+  bench("write varint u32", bytes, [&] {
+    leb.clear();
+    OByteStream out{leb};
+    out << Varint{values.size()};
+    for (const auto v : values) out << Varint{v};
+    return leb.size();
+  });
+  GroupVarints packed{values};
+  bench("write group varint u32", bytes, [&] {
+    group.clear();
+    OByteStream{group} << packed;
+    return group.size();
+  });
+
+  std::vector<std::uint32_t> out;
+  bench("read fixed u32", bytes, [&] {
+    IByteStream{fixed} >> out;
+    return out.size();
+  });
+  bench("read varint u32", bytes, [&] {
+    IByteStream in{leb};
+    Varint<std::size_t> n;
+    in >> n;
+    out.resize(n);
+    for (auto &v : out) {
+      Varint<std::uint32_t> x;
+      in >> x;
+      v = x;
+    }
+    return out.size();
+  });
+  bench("read group varint u32", bytes, [&] {
+    IByteStream{group} >> packed;
+    return packed.values.size();
+  });
+}
+
+void benchJson()
+{
+  const std::array<std::pair<std::string_view, std::string_view>, 2> samples{{
+      {"plain", "Hello World, from Japan and други места. λ 😀 0123456789 "},
+      {"escapes", "Hello \"World\",\tfrom Japan and други места.\nλ 😀 C:\\path\\to\\file "},
+  }};
+
+  for (const auto &[name, sample] : samples) {
+    std::string text;
+    while (text.size() < (16 << 20)) text += sample;
+
+    ByteBuffer escaped(text.size() * 2);
+    bench(std::format("jsonEscape ({})", name), text.size(), [&] {
+      escaped.clear();
+      jsonEscape(text, escaped);
+      return escaped.size();
+    });
+
+    // Skip the opening quote
+    const std::string_view body(reinterpret_cast<const char *>(escaped.bytes().data()) + 1, escaped.size() - 1);
+    ByteBuffer unescaped(text.size());
+    bench(std::format("jsonUnescape ({})", name), body.size(), [&] {
+      unescaped.clear();
+      return jsonUnescape(body, unescaped).value_or(0);
+    });
+  }
+}
+
+// Compares decoding whole records against inspecting one field of each in
+// place, and reading strings as copies against views.
+void benchViews()
+{
+  struct Record {
+    std::uint64_t id;
+    std::uint32_t kind;
+    double value;
+    std::uint16_t flags;
+  };
+
+  std::vector<Record> records(1 << 20);
+  for (std::size_t i = 0; i < records.size(); ++i) records[i] = {i, static_cast<std::uint32_t>(i % 7), i * 0.5, 0};
+  ByteBuffer buf;
+  OByteStream<WireFormat::Big>{buf} << records;
+  const auto bytes = buf.size();
+
+  std::vector<Record> decoded;
+  bench("sum Record::kind (decoded)", bytes, [&] {
+    IByteStream<WireFormat::Big>{buf} >> decoded;
+    std::uint64_t kinds = 0;
+    for (const auto &r : decoded) kinds += r.kind;
+    return kinds;
+  });
+  bench("sum Record::kind (ArrayView)", bytes, [&] {
+    ArrayView<Record, WireFormat::Big> view;
+    IByteStream<WireFormat::Big>{buf} >> view;
+    std::uint64_t kinds = 0;
+    for (std::size_t i = 0; i < view.size(); ++i) kinds += view[i].get<1>();
+    return kinds;
+  });
+
+  std::vector<std::string> words(1 << 18);
+  for (std::size_t i = 0; i < words.size(); ++i) words[i] = std::format("a somewhat longer word number {}", i);
+  ByteBuffer text;
+  OByteStream<WireFormat::Little> out{text};
+  for (const auto &word : words) out << word;
+  bench("read strings (copied)", text.size(), [&] {
+    IByteStream<WireFormat::Little> in{text};
+    std::string word;
+    std::size_t total = 0;
+    while (in.remaining() && in.read(word)) total += word.size();
+    return total;
+  });
+  bench("read strings (viewed)", text.size(), [&] {
+    IByteStream<WireFormat::Little> in{text};
+    std::string_view word;
+    std::size_t total = 0;
+    while (in.remaining() && in.read(word)) total += word.size();
+    return total;
+  });
+}
+
+// Compares copying large payloads into one buffer and writing it against
+// gathering them in place with writev, rewriting the same temporary file.
+void benchGather()
+{
+  struct Message {
+    std::uint32_t id;
+    std::string topic;
+    std::vector<std::byte> payload;
+  };
+
+  std::vector<Message> messages(256);
+  for (std::size_t i = 0; i < messages.size(); ++i)
+    messages[i] = {static_cast<std::uint32_t>(i), std::format("topic-{}", i % 8), ByteVec(64 << 10, std::byte(i))};
+  const auto bytes = messages.size() * (64 << 10);
+
+  char path[] = "/tmp/serde-bench-XXXXXX";
+  const int fd = ::mkstemp(path);
+  if (fd < 0) return;
+  ::unlink(path);
+
+  ByteBuffer buf(bytes + (64 << 10));
+  bench("write messages (copied)", bytes, [&] {
+    buf.clear();
+    OByteStream{buf} << messages;
+    return ::pwrite(fd, buf.bytes().data(), buf.size(), 0) > 0;
+  });
+  GatherBuffer gather;
+  bench("write messages (gathered)", bytes, [&] {
+    OByteStream{gather}.borrow(messages);
+    ::lseek(fd, 0, SEEK_SET);
+    return gather.flush(fd);
+  });
+
+  ::close(fd);
+}
+
+// Compares logging records with a blocking write(2) per buffer against the
+// asynchronous sink on each backend, through the page cache and with
+// synchronous writes, then reads them back.
+void benchAsync()
+{
+  struct LogRecord {
+    std::uint64_t timestamp;
+    std::uint32_t level;
+    std::string message;
+  };
+
+  std::vector<LogRecord> records(1 << 20);
+  for (std::size_t i = 0; i < records.size(); ++i)
+    records[i] = {i * 1000, static_cast<std::uint32_t>(i % 5), std::format("request {} served in {} us", i, i % 997)};
+
+  char path[] = "/tmp/serde-bench-XXXXXX";
+  const int tmp = ::mkstemp(path);
+  if (tmp < 0) return;
+  ::close(tmp);
+
+  // Through the page cache, then waiting for the disk on every write
+  for (const int flags : {0, O_DSYNC}) {
+    const int fd = ::open(path, O_RDWR | flags);
+    if (fd < 0) break;
+    const auto suffix = flags == 0 ? "" : " dsync";
+
+    ByteBuffer buf(1 << 20);
+    benchRecords(std::format("log write(2){}", suffix), records.size(), [&] {
+      std::uint64_t offset = 0;
+      bool failed = false;
+      auto flush = [&] {
+        failed |= ::pwrite(fd, buf.bytes().data(), buf.size(), offset) != static_cast<ssize_t>(buf.size());
+        offset += buf.size();
+        buf.clear();
+      };
+      OByteStream out{buf};
+      for (const auto &record : records) {
+        out << record;
+        if (buf.size() >= (1 << 20)) flush();
+      }
+      flush();
+      return failed ? 0 : offset;
+    });
+
+    for (const auto backend : {IoBackend::Ring, IoBackend::Threads}) {
+      IoBackend used = backend;
+      benchRecords(std::format("log AsyncSink ({}){}", backend == IoBackend::Ring ? "io_uring" : "threads", suffix), records.size(), [&] {
+        AsyncSink sink(fd, 0, 1 << 20, backend);
+        used = sink.backend();
+        OByteStream out{sink};
+        for (const auto &record : records) out << record;
+        sink.flush();
+        return sink.offset();
+      });
+      if (used != backend) std::println("  (io_uring unavailable, ran on threads)");
+    }
+
+    if (flags == 0) {
+      for (const auto backend : {IoBackend::Ring, IoBackend::Threads}) {
+        benchRecords(backend == IoBackend::Ring ? "read AsyncSource (io_uring)" : "read AsyncSource (threads)", records.size(), [&] {
+          AsyncSource source(fd, 0, 1 << 20, backend);
+          LogRecord record;
+          std::size_t count = 0;
+          while (source.read(record)) ++count;
+          return count;
+        });
+      }
+    }
+    ::close(fd);
+  }
+  ::unlink(path);
+}
+
+// Compares building a large buffer from small writes in one growing vector
+// against chained segments, then reading the segments back.
+void benchSegmented()
+{
+  std::vector<std::string> words(1 << 20);
+  for (std::size_t i = 0; i < words.size(); ++i) words[i] = std::format("word number {} of many", i);
+  ByteBuffer sized;
+  OByteStream{sized} << words;
+  const auto bytes = sized.size();
+
+  ByteBuffer buf;
+  bench("write strings (ByteBuffer)", bytes, [&] {
+    buf.clear();
+    OByteStream out{buf};
+    for (const auto &word : words) out << word;
+    return buf.size();
+  });
+  SegmentedBuffer segmented;
+  bench("write strings (SegmentedBuffer)", bytes, [&] {
+    segmented.clear();
+    OByteStream out{segmented};
+    for (const auto &word : words) out << word;
+    return segmented.size();
+  });
+
+  bench("read strings (ByteBuffer)", bytes, [&] {
+    IByteStream in{sized};
+    std::uint64_t n = 0;
+    in >> n;
+    std::string word;
+    std::size_t total = 0;
+    while (in.read(word) && in.remaining()) total += word.size();
+    return total;
+  });
+  bench("read strings (SegmentedBuffer)", bytes, [&] {
+    IByteStream in{segmented};
+    std::string word;
+    std::size_t total = 0;
+    while (in.read(word) && in.remaining()) total += word.size();
+    return total;
+  });
+}
+
+// Compares creating and dropping a buffer per request on the heap against
+// the buffer pool, and reports how many blocks the pool had to allocate.
+void benchPool()
+{
+  struct HeapBuffer {
+    ByteVec bytes;
+
+    void reserve(std::size_t extra)
+    {
+      if (bytes.size() + extra > bytes.capacity()) bytes.reserve(std::max(bytes.size() + extra, 2 * bytes.capacity()));
+    }
+
+    std::size_t write(ByteSpan b)
+    {
+      bytes.insert(bytes.end(), b.begin(), b.end());
+      return b.size();
+    }
+  };
+
+  struct Request {
+    std::uint64_t id;
+    std::string path;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::vector<std::byte> body;
+  };
+
+  std::vector<Request> requests(1024);
+  for (std::size_t i = 0; i < requests.size(); ++i)
+    requests[i] = {i, std::format("/api/v1/items/{}", i), {{"host", "example.com"}, {"accept", "*/*"}}, ByteVec(64 << (i % 8), std::byte(i))};
+  std::size_t bytes = 0;
+  for (const auto &request : requests) {
+    ByteBuffer buf;
+    OByteStream{buf} << request;
+    bytes += buf.size();
+  }
+
+  bench("serialize requests (heap)", bytes * 16, [&] {
+    std::size_t total = 0;
+    for (int round = 0; round < 16; ++round) {
+      for (const auto &request : requests) {
+        HeapBuffer buf;
+        buf.bytes.reserve(128);
+        OByteStream{buf} << request;
+        total += buf.bytes.size();
+      }
+    }
+    return total;
+  });
+
+  auto &pool = BufferPool::local();
+  const auto fresh = pool.freshBlocks();
+  bench("serialize requests (pool)", bytes * 16, [&] {
+    std::size_t total = 0;
+    for (int round = 0; round < 16; ++round) {
+      for (const auto &request : requests) {
+        ByteBuffer buf;
+        OByteStream{buf} << request;
+        total += buf.size();
+      }
+    }
+    return total;
+  });
+  std::println("  pool: {} fresh blocks over 4 runs, {} KiB cached", pool.freshBlocks() - fresh, pool.cached() >> 10);
+}
+
+// Whether `value` reads back equal from its encoding in `Format`, with
+// nothing left over.
+template<WireFormat Format, typename T>
+auto roundTrips(const T &value) -> bool
+{
+  ByteBuffer buf;
+  OByteStream<Format>{buf} << value;
+  IByteStream<Format> in{buf};
+  T back{};
+  return in.read(back) && back == value && in.remaining() == 0;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1 && std::string_view(argv[1]) == "bench") {
+    benchJson();
+    benchContainers();
+    benchIntegers();
+    benchViews();
+    benchGather();
+    benchSegmented();
+    benchPool();
+    benchAsync();
+    return 0;
+  }
+
+  ByteBuffer buf;
+  OByteStream ostream{buf};
+
+  ostream << 10 << 0.5F << 0x1122334455667788UL;
+
+  IByteStream istream{buf};
+  int x{};
+  float y{};
+  size_t z{};
+  istream >> x >> y >> z;
+
+  std::println("{} {} {:#x}", x, y, z);
+
+  // Optionals carry a presence flag in every format
+  for (const auto o : {std::optional<int>(5), std::optional<int>()}) {
+    assert(roundTrips<WireFormat::Native>(o));
+    assert(roundTrips<WireFormat::Little>(o));
+    assert(roundTrips<WireFormat::Big>(o));
+  }
+
+  // Varints that overflow 64 bits or the target type are malformed
+  {
+    ByteVec overflow(max_varint_bytes - 1, std::byte{0xff});
+    overflow.push_back(std::byte{0x02});
+    IByteStream in{ByteSpan(overflow)};
+    Varint<std::uint64_t> v;
+    assert(!in.read(v) && in.error() == ReadError::Malformed);
+
+    ByteBuffer wide;
+    OByteStream{wide} << Varint{300U};
+    IByteStream narrow{wide};
+    Varint<std::uint8_t> b;
+    assert(!narrow.read(b) && narrow.error() == ReadError::Malformed);
+  }
+
+  // Native views find fields past the padding before them
+  {
+    struct Padded {
+      std::uint8_t tag;
+      double value;
+      std::uint16_t flags;
+    };
+    ByteBuffer padded;
+    OByteStream{padded} << Padded{1, 2.5, 3};
+    View<Padded, WireFormat::Native> view;
+    IByteStream{padded} >> view;
+    assert(view.get<1>() == 2.5 && view.get<2>() == 3);
+  }
+
+  // A working set dropped at once stays cached for the next round, even
+  // with some churn in between
+  {
+    auto &pool = BufferPool::local();
+    std::vector<ByteBuffer> buffers;
+    std::size_t fresh = 0;
+    for (int round = 0; round < 2; ++round) {
+      buffers.resize(3 * BufferPool::trim_interval);
+      buffers.clear();
+      ByteBuffer single;
+      if (round == 0) fresh = pool.freshBlocks();
+    }
+    assert(pool.freshBlocks() == fresh);
+  }
 }
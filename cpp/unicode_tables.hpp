@@ -0,0 +1,1971 @@
+#ifndef UNICODE_TABLES_HPP
+#define UNICODE_TABLES_HPP
+
+// Unicode property tables used by utf8.cpp.
+//
+// Generated from the Unicode Character Database 14.0. Ranges are sorted and
+// disjoint; short gaps made only of unassigned code points are folded into
+// the surrounding range.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+struct CodePointRange {
+  char32_t first;
+  char32_t last;
+};
+
+// Returns whether `cp` falls in one of the sorted, disjoint `ranges`.
+template<std::size_t N>
+constexpr auto in_ranges(char32_t cp, const std::array<CodePointRange, N> &ranges) -> bool {
+  if (cp < ranges.front().first || cp > ranges.back().last) return false;
+  const auto it = std::ranges::upper_bound(ranges, cp, {}, &CodePointRange::first);
+  return cp <= std::prev(it)->last;
+}
+
+// Display width
+
+// Combining marks (Mn, Me), format characters (Cf) except SOFT HYPHEN,
+// ZERO WIDTH SPACE and Hangul medial vowels / final consonants.
+constexpr std::array<CodePointRange, 316> zero_width_ranges{{
+    {0x0300, 0x036f}, {0x0483, 0x0489}, {0x0591, 0x05bd}, {0x05bf, 0x05bf}, {0x05c1, 0x05c2}, {0x05c4, 0x05c5},
+    {0x05c7, 0x05c7}, {0x0600, 0x0605}, {0x0610, 0x061a}, {0x061c, 0x061c}, {0x064b, 0x065f}, {0x0670, 0x0670},
+    {0x06d6, 0x06dd}, {0x06df, 0x06e4}, {0x06e7, 0x06e8}, {0x06ea, 0x06ed}, {0x070f, 0x070f}, {0x0711, 0x0711},
+    {0x0730, 0x074a}, {0x07a6, 0x07b0}, {0x07eb, 0x07f3}, {0x07fd, 0x07fd}, {0x0816, 0x0819}, {0x081b, 0x0823},
+    {0x0825, 0x0827}, {0x0829, 0x082d}, {0x0859, 0x085b}, {0x0890, 0x089f}, {0x08ca, 0x0902}, {0x093a, 0x093a},
+    {0x093c, 0x093c}, {0x0941, 0x0948}, {0x094d, 0x094d}, {0x0951, 0x0957}, {0x0962, 0x0963}, {0x0981, 0x0981},
+    {0x09bc, 0x09bc}, {0x09c1, 0x09c4}, {0x09cd, 0x09cd}, {0x09e2, 0x09e3}, {0x09fe, 0x0a02}, {0x0a3c, 0x0a3c},
+    {0x0a41, 0x0a51}, {0x0a70, 0x0a71}, {0x0a75, 0x0a75}, {0x0a81, 0x0a82}, {0x0abc, 0x0abc}, {0x0ac1, 0x0ac8},
+    {0x0acd, 0x0acd}, {0x0ae2, 0x0ae3}, {0x0afa, 0x0b01}, {0x0b3c, 0x0b3c}, {0x0b3f, 0x0b3f}, {0x0b41, 0x0b44},
+    {0x0b4d, 0x0b56}, {0x0b62, 0x0b63}, {0x0b82, 0x0b82}, {0x0bc0, 0x0bc0}, {0x0bcd, 0x0bcd}, {0x0c00, 0x0c00},
+    {0x0c04, 0x0c04}, {0x0c3c, 0x0c3c}, {0x0c3e, 0x0c40}, {0x0c46, 0x0c56}, {0x0c62, 0x0c63}, {0x0c81, 0x0c81},
+    {0x0cbc, 0x0cbc}, {0x0cbf, 0x0cbf}, {0x0cc6, 0x0cc6}, {0x0ccc, 0x0ccd}, {0x0ce2, 0x0ce3}, {0x0d00, 0x0d01},
+    {0x0d3b, 0x0d3c}, {0x0d41, 0x0d44}, {0x0d4d, 0x0d4d}, {0x0d62, 0x0d63}, {0x0d81, 0x0d81}, {0x0dca, 0x0dca},
+    {0x0dd2, 0x0dd6}, {0x0e31, 0x0e31}, {0x0e34, 0x0e3a}, {0x0e47, 0x0e4e}, {0x0eb1, 0x0eb1}, {0x0eb4, 0x0ebc},
+    {0x0ec8, 0x0ecd}, {0x0f18, 0x0f19}, {0x0f35, 0x0f35}, {0x0f37, 0x0f37}, {0x0f39, 0x0f39}, {0x0f71, 0x0f7e},
+    {0x0f80, 0x0f84}, {0x0f86, 0x0f87}, {0x0f8d, 0x0fbc}, {0x0fc6, 0x0fc6}, {0x102d, 0x1030}, {0x1032, 0x1037},
+    {0x1039, 0x103a}, {0x103d, 0x103e}, {0x1058, 0x1059}, {0x105e, 0x1060}, {0x1071, 0x1074}, {0x1082, 0x1082},
+    {0x1085, 0x1086}, {0x108d, 0x108d}, {0x109d, 0x109d}, {0x1160, 0x11ff}, {0x135d, 0x135f}, {0x1712, 0x1714},
+    {0x1732, 0x1733}, {0x1752, 0x1753}, {0x1772, 0x1773}, {0x17b4, 0x17b5}, {0x17b7, 0x17bd}, {0x17c6, 0x17c6},
+    {0x17c9, 0x17d3}, {0x17dd, 0x17dd}, {0x180b, 0x180f}, {0x1885, 0x1886}, {0x18a9, 0x18a9}, {0x1920, 0x1922},
+    {0x1927, 0x1928}, {0x1932, 0x1932}, {0x1939, 0x193b}, {0x1a17, 0x1a18}, {0x1a1b, 0x1a1b}, {0x1a56, 0x1a56},
+    {0x1a58, 0x1a60}, {0x1a62, 0x1a62}, {0x1a65, 0x1a6c}, {0x1a73, 0x1a7f}, {0x1ab0, 0x1ace}, {0x1b00, 0x1b03},
+    {0x1b34, 0x1b34}, {0x1b36, 0x1b3a}, {0x1b3c, 0x1b3c}, {0x1b42, 0x1b42}, {0x1b6b, 0x1b73}, {0x1b80, 0x1b81},
+    {0x1ba2, 0x1ba5}, {0x1ba8, 0x1ba9}, {0x1bab, 0x1bad}, {0x1be6, 0x1be6}, {0x1be8, 0x1be9}, {0x1bed, 0x1bed},
+    {0x1bef, 0x1bf1}, {0x1c2c, 0x1c33}, {0x1c36, 0x1c37}, {0x1cd0, 0x1cd2}, {0x1cd4, 0x1ce0}, {0x1ce2, 0x1ce8},
+    {0x1ced, 0x1ced}, {0x1cf4, 0x1cf4}, {0x1cf8, 0x1cf9}, {0x1dc0, 0x1dff}, {0x200b, 0x200f}, {0x202a, 0x202e},
+    {0x2060, 0x206f}, {0x20d0, 0x20f0}, {0x2cef, 0x2cf1}, {0x2d7f, 0x2d7f}, {0x2de0, 0x2dff}, {0x302a, 0x302d},
+    {0x3099, 0x309a}, {0xa66f, 0xa672}, {0xa674, 0xa67d}, {0xa69e, 0xa69f}, {0xa6f0, 0xa6f1}, {0xa802, 0xa802},
+    {0xa806, 0xa806}, {0xa80b, 0xa80b}, {0xa825, 0xa826}, {0xa82c, 0xa82c}, {0xa8c4, 0xa8c5}, {0xa8e0, 0xa8f1},
+    {0xa8ff, 0xa8ff}, {0xa926, 0xa92d}, {0xa947, 0xa951}, {0xa980, 0xa982}, {0xa9b3, 0xa9b3}, {0xa9b6, 0xa9b9},
+    {0xa9bc, 0xa9bd}, {0xa9e5, 0xa9e5}, {0xaa29, 0xaa2e}, {0xaa31, 0xaa32}, {0xaa35, 0xaa36}, {0xaa43, 0xaa43},
+    {0xaa4c, 0xaa4c}, {0xaa7c, 0xaa7c}, {0xaab0, 0xaab0}, {0xaab2, 0xaab4}, {0xaab7, 0xaab8}, {0xaabe, 0xaabf},
+    {0xaac1, 0xaac1}, {0xaaec, 0xaaed}, {0xaaf6, 0xaaf6}, {0xabe5, 0xabe5}, {0xabe8, 0xabe8}, {0xabed, 0xabed},
+    {0xfb1e, 0xfb1e}, {0xfe00, 0xfe0f}, {0xfe20, 0xfe2f}, {0xfeff, 0xfeff}, {0xfff9, 0xfffb}, {0x101fd, 0x101fd},
+    {0x102e0, 0x102e0}, {0x10376, 0x1037a}, {0x10a01, 0x10a0f}, {0x10a38, 0x10a3f}, {0x10ae5, 0x10ae6}, {0x10d24, 0x10d27},
+    {0x10eab, 0x10eac}, {0x10f46, 0x10f50}, {0x10f82, 0x10f85}, {0x11001, 0x11001}, {0x11038, 0x11046}, {0x11070, 0x11070},
+    {0x11073, 0x11074}, {0x1107f, 0x11081}, {0x110b3, 0x110b6}, {0x110b9, 0x110ba}, {0x110bd, 0x110bd}, {0x110c2, 0x110cd},
+    {0x11100, 0x11102}, {0x11127, 0x1112b}, {0x1112d, 0x11134}, {0x11173, 0x11173}, {0x11180, 0x11181}, {0x111b6, 0x111be},
+    {0x111c9, 0x111cc}, {0x111cf, 0x111cf}, {0x1122f, 0x11231}, {0x11234, 0x11234}, {0x11236, 0x11237}, {0x1123e, 0x1123e},
+    {0x112df, 0x112df}, {0x112e3, 0x112ea}, {0x11300, 0x11301}, {0x1133b, 0x1133c}, {0x11340, 0x11340}, {0x11366, 0x11374},
+    {0x11438, 0x1143f}, {0x11442, 0x11444}, {0x11446, 0x11446}, {0x1145e, 0x1145e}, {0x114b3, 0x114b8}, {0x114ba, 0x114ba},
+    {0x114bf, 0x114c0}, {0x114c2, 0x114c3}, {0x115b2, 0x115b5}, {0x115bc, 0x115bd}, {0x115bf, 0x115c0}, {0x115dc, 0x115dd},
+    {0x11633, 0x1163a}, {0x1163d, 0x1163d}, {0x1163f, 0x11640}, {0x116ab, 0x116ab}, {0x116ad, 0x116ad}, {0x116b0, 0x116b5},
+    {0x116b7, 0x116b7}, {0x1171d, 0x1171f}, {0x11722, 0x11725}, {0x11727, 0x1172b}, {0x1182f, 0x11837}, {0x11839, 0x1183a},
+    {0x1193b, 0x1193c}, {0x1193e, 0x1193e}, {0x11943, 0x11943}, {0x119d4, 0x119db}, {0x119e0, 0x119e0}, {0x11a01, 0x11a0a},
+    {0x11a33, 0x11a38}, {0x11a3b, 0x11a3e}, {0x11a47, 0x11a47}, {0x11a51, 0x11a56}, {0x11a59, 0x11a5b}, {0x11a8a, 0x11a96},
+    {0x11a98, 0x11a99}, {0x11c30, 0x11c3d}, {0x11c3f, 0x11c3f}, {0x11c92, 0x11ca7}, {0x11caa, 0x11cb0}, {0x11cb2, 0x11cb3},
+    {0x11cb5, 0x11cb6}, {0x11d31, 0x11d45}, {0x11d47, 0x11d47}, {0x11d90, 0x11d91}, {0x11d95, 0x11d95}, {0x11d97, 0x11d97},
+    {0x11ef3, 0x11ef4}, {0x13430, 0x13438}, {0x16af0, 0x16af4}, {0x16b30, 0x16b36}, {0x16f4f, 0x16f4f}, {0x16f8f, 0x16f92},
+    {0x16fe4, 0x16fe4}, {0x1bc9d, 0x1bc9e}, {0x1bca0, 0x1bca3}, {0x1cf00, 0x1cf46}, {0x1d167, 0x1d169}, {0x1d173, 0x1d182},
+    {0x1d185, 0x1d18b}, {0x1d1aa, 0x1d1ad}, {0x1d242, 0x1d244}, {0x1da00, 0x1da36}, {0x1da3b, 0x1da6c}, {0x1da75, 0x1da75},
+    {0x1da84, 0x1da84}, {0x1da9b, 0x1daaf}, {0x1e000, 0x1e02a}, {0x1e130, 0x1e136}, {0x1e2ae, 0x1e2ae}, {0x1e2ec, 0x1e2ef},
+    {0x1e8d0, 0x1e8d6}, {0x1e944, 0x1e94a}, {0xe0001, 0xe007f}, {0xe0100, 0xe01ef},
+}};
+
+// East_Asian_Width W or F, plus the unassigned parts of planes 2 and 3.
+constexpr std::array<CodePointRange, 88> wide_ranges{{
+    {0x1100, 0x115f}, {0x231a, 0x231b}, {0x2329, 0x232a}, {0x23e9, 0x23ec}, {0x23f0, 0x23f0}, {0x23f3, 0x23f3},
+    {0x25fd, 0x25fe}, {0x2614, 0x2615}, {0x2648, 0x2653}, {0x267f, 0x267f}, {0x2693, 0x2693}, {0x26a1, 0x26a1},
+    {0x26aa, 0x26ab}, {0x26bd, 0x26be}, {0x26c4, 0x26c5}, {0x26ce, 0x26ce}, {0x26d4, 0x26d4}, {0x26ea, 0x26ea},
+    {0x26f2, 0x26f3}, {0x26f5, 0x26f5}, {0x26fa, 0x26fa}, {0x26fd, 0x26fd}, {0x2705, 0x2705}, {0x270a, 0x270b},
+    {0x2728, 0x2728}, {0x274c, 0x274c}, {0x274e, 0x274e}, {0x2753, 0x2755}, {0x2757, 0x2757}, {0x2795, 0x2797},
+    {0x27b0, 0x27b0}, {0x27bf, 0x27bf}, {0x2b1b, 0x2b1c}, {0x2b50, 0x2b50}, {0x2b55, 0x2b55}, {0x2e80, 0x3029},
+    {0x302e, 0x303e}, {0x3041, 0x3096}, {0x309b, 0x3247}, {0x3250, 0x4dbf}, {0x4e00, 0xa4c6}, {0xa960, 0xa97c},
+    {0xac00, 0xd7a3}, {0xf900, 0xfad9}, {0xfe10, 0xfe19}, {0xfe30, 0xfe6b}, {0xff01, 0xff60}, {0xffe0, 0xffe6},
+    {0x16fe0, 0x16fe3}, {0x16ff0, 0x18cd5}, {0x18d00, 0x18d08}, {0x1aff0, 0x1b122}, {0x1b150, 0x1b2fb}, {0x1f004, 0x1f004},
+    {0x1f0cf, 0x1f0cf}, {0x1f18e, 0x1f18e}, {0x1f191, 0x1f19a}, {0x1f200, 0x1f265}, {0x1f300, 0x1f320}, {0x1f32d, 0x1f335},
+    {0x1f337, 0x1f37c}, {0x1f37e, 0x1f393}, {0x1f3a0, 0x1f3ca}, {0x1f3cf, 0x1f3d3}, {0x1f3e0, 0x1f3f0}, {0x1f3f4, 0x1f3f4},
+    {0x1f3f8, 0x1f43e}, {0x1f440, 0x1f440}, {0x1f442, 0x1f4fc}, {0x1f4ff, 0x1f53d}, {0x1f54b, 0x1f54e}, {0x1f550, 0x1f567},
+    {0x1f57a, 0x1f57a}, {0x1f595, 0x1f596}, {0x1f5a4, 0x1f5a4}, {0x1f5fb, 0x1f64f}, {0x1f680, 0x1f6c5}, {0x1f6cc, 0x1f6cc},
+    {0x1f6d0, 0x1f6d2}, {0x1f6d5, 0x1f6df}, {0x1f6eb, 0x1f6ec}, {0x1f6f4, 0x1f6fc}, {0x1f7e0, 0x1f7f0}, {0x1f90c, 0x1f93a},
+    {0x1f93c, 0x1f945}, {0x1f947, 0x1f9ff}, {0x1fa70, 0x1faf6}, {0x20000, 0x3fffd},
+}};
+
+// Normalization
+
+struct CombiningClassRange {
+  char32_t first;
+  char32_t last;
+  uint8_t ccc;
+};
+
+// Canonical_Combining_Class of every code point with a non-zero class.
+constexpr std::array<CombiningClassRange, 382> combining_class_ranges{{
+    {0x0300, 0x0314, 230}, {0x0315, 0x0315, 232}, {0x0316, 0x0319, 220}, {0x031a, 0x031a, 232}, {0x031b, 0x031b, 216},
+    {0x031c, 0x0320, 220}, {0x0321, 0x0322, 202}, {0x0323, 0x0326, 220}, {0x0327, 0x0328, 202}, {0x0329, 0x0333, 220},
+    {0x0334, 0x0338, 1}, {0x0339, 0x033c, 220}, {0x033d, 0x0344, 230}, {0x0345, 0x0345, 240}, {0x0346, 0x0346, 230},
+    {0x0347, 0x0349, 220}, {0x034a, 0x034c, 230}, {0x034d, 0x034e, 220}, {0x0350, 0x0352, 230}, {0x0353, 0x0356, 220},
+    {0x0357, 0x0357, 230}, {0x0358, 0x0358, 232}, {0x0359, 0x035a, 220}, {0x035b, 0x035b, 230}, {0x035c, 0x035c, 233},
+    {0x035d, 0x035e, 234}, {0x035f, 0x035f, 233}, {0x0360, 0x0361, 234}, {0x0362, 0x0362, 233}, {0x0363, 0x036f, 230},
+    {0x0483, 0x0487, 230}, {0x0591, 0x0591, 220}, {0x0592, 0x0595, 230}, {0x0596, 0x0596, 220}, {0x0597, 0x0599, 230},
+    {0x059a, 0x059a, 222}, {0x059b, 0x059b, 220}, {0x059c, 0x05a1, 230}, {0x05a2, 0x05a7, 220}, {0x05a8, 0x05a9, 230},
+    {0x05aa, 0x05aa, 220}, {0x05ab, 0x05ac, 230}, {0x05ad, 0x05ad, 222}, {0x05ae, 0x05ae, 228}, {0x05af, 0x05af, 230},
+    {0x05b0, 0x05b0, 10}, {0x05b1, 0x05b1, 11}, {0x05b2, 0x05b2, 12}, {0x05b3, 0x05b3, 13}, {0x05b4, 0x05b4, 14},
+    {0x05b5, 0x05b5, 15}, {0x05b6, 0x05b6, 16}, {0x05b7, 0x05b7, 17}, {0x05b8, 0x05b8, 18}, {0x05b9, 0x05ba, 19},
+    {0x05bb, 0x05bb, 20}, {0x05bc, 0x05bc, 21}, {0x05bd, 0x05bd, 22}, {0x05bf, 0x05bf, 23}, {0x05c1, 0x05c1, 24},
+    {0x05c2, 0x05c2, 25}, {0x05c4, 0x05c4, 230}, {0x05c5, 0x05c5, 220}, {0x05c7, 0x05c7, 18}, {0x0610, 0x0617, 230},
+    {0x0618, 0x0618, 30}, {0x0619, 0x0619, 31}, {0x061a, 0x061a, 32}, {0x064b, 0x064b, 27}, {0x064c, 0x064c, 28},
+    {0x064d, 0x064d, 29}, {0x064e, 0x064e, 30}, {0x064f, 0x064f, 31}, {0x0650, 0x0650, 32}, {0x0651, 0x0651, 33},
+    {0x0652, 0x0652, 34}, {0x0653, 0x0654, 230}, {0x0655, 0x0656, 220}, {0x0657, 0x065b, 230}, {0x065c, 0x065c, 220},
+    {0x065d, 0x065e, 230}, {0x065f, 0x065f, 220}, {0x0670, 0x0670, 35}, {0x06d6, 0x06dc, 230}, {0x06df, 0x06e2, 230},
+    {0x06e3, 0x06e3, 220}, {0x06e4, 0x06e4, 230}, {0x06e7, 0x06e8, 230}, {0x06ea, 0x06ea, 220}, {0x06eb, 0x06ec, 230},
+    {0x06ed, 0x06ed, 220}, {0x0711, 0x0711, 36}, {0x0730, 0x0730, 230}, {0x0731, 0x0731, 220}, {0x0732, 0x0733, 230},
+    {0x0734, 0x0734, 220}, {0x0735, 0x0736, 230}, {0x0737, 0x0739, 220}, {0x073a, 0x073a, 230}, {0x073b, 0x073c, 220},
+    {0x073d, 0x073d, 230}, {0x073e, 0x073e, 220}, {0x073f, 0x0741, 230}, {0x0742, 0x0742, 220}, {0x0743, 0x0743, 230},
+    {0x0744, 0x0744, 220}, {0x0745, 0x0745, 230}, {0x0746, 0x0746, 220}, {0x0747, 0x0747, 230}, {0x0748, 0x0748, 220},
+    {0x0749, 0x074a, 230}, {0x07eb, 0x07f1, 230}, {0x07f2, 0x07f2, 220}, {0x07f3, 0x07f3, 230}, {0x07fd, 0x07fd, 220},
+    {0x0816, 0x0819, 230}, {0x081b, 0x0823, 230}, {0x0825, 0x0827, 230}, {0x0829, 0x082d, 230}, {0x0859, 0x085b, 220},
+    {0x0898, 0x0898, 230}, {0x0899, 0x089b, 220}, {0x089c, 0x089f, 230}, {0x08ca, 0x08ce, 230}, {0x08cf, 0x08d3, 220},
+    {0x08d4, 0x08e1, 230}, {0x08e3, 0x08e3, 220}, {0x08e4, 0x08e5, 230}, {0x08e6, 0x08e6, 220}, {0x08e7, 0x08e8, 230},
+    {0x08e9, 0x08e9, 220}, {0x08ea, 0x08ec, 230}, {0x08ed, 0x08ef, 220}, {0x08f0, 0x08f0, 27}, {0x08f1, 0x08f1, 28},
+    {0x08f2, 0x08f2, 29}, {0x08f3, 0x08f5, 230}, {0x08f6, 0x08f6, 220}, {0x08f7, 0x08f8, 230}, {0x08f9, 0x08fa, 220},
+    {0x08fb, 0x08ff, 230}, {0x093c, 0x093c, 7}, {0x094d, 0x094d, 9}, {0x0951, 0x0951, 230}, {0x0952, 0x0952, 220},
+    {0x0953, 0x0954, 230}, {0x09bc, 0x09bc, 7}, {0x09cd, 0x09cd, 9}, {0x09fe, 0x09fe, 230}, {0x0a3c, 0x0a3c, 7},
+    {0x0a4d, 0x0a4d, 9}, {0x0abc, 0x0abc, 7}, {0x0acd, 0x0acd, 9}, {0x0b3c, 0x0b3c, 7}, {0x0b4d, 0x0b4d, 9},
+    {0x0bcd, 0x0bcd, 9}, {0x0c3c, 0x0c3c, 7}, {0x0c4d, 0x0c4d, 9}, {0x0c55, 0x0c55, 84}, {0x0c56, 0x0c56, 91},
+    {0x0cbc, 0x0cbc, 7}, {0x0ccd, 0x0ccd, 9}, {0x0d3b, 0x0d3c, 9}, {0x0d4d, 0x0d4d, 9}, {0x0dca, 0x0dca, 9},
+    {0x0e38, 0x0e39, 103}, {0x0e3a, 0x0e3a, 9}, {0x0e48, 0x0e4b, 107}, {0x0eb8, 0x0eb9, 118}, {0x0eba, 0x0eba, 9},
+    {0x0ec8, 0x0ecb, 122}, {0x0f18, 0x0f19, 220}, {0x0f35, 0x0f35, 220}, {0x0f37, 0x0f37, 220}, {0x0f39, 0x0f39, 216},
+    {0x0f71, 0x0f71, 129}, {0x0f72, 0x0f72, 130}, {0x0f74, 0x0f74, 132}, {0x0f7a, 0x0f7d, 130}, {0x0f80, 0x0f80, 130},
+    {0x0f82, 0x0f83, 230}, {0x0f84, 0x0f84, 9}, {0x0f86, 0x0f87, 230}, {0x0fc6, 0x0fc6, 220}, {0x1037, 0x1037, 7},
+    {0x1039, 0x103a, 9}, {0x108d, 0x108d, 220}, {0x135d, 0x135f, 230}, {0x1714, 0x1715, 9}, {0x1734, 0x1734, 9},
+    {0x17d2, 0x17d2, 9}, {0x17dd, 0x17dd, 230}, {0x18a9, 0x18a9, 228}, {0x1939, 0x1939, 222}, {0x193a, 0x193a, 230},
+    {0x193b, 0x193b, 220}, {0x1a17, 0x1a17, 230}, {0x1a18, 0x1a18, 220}, {0x1a60, 0x1a60, 9}, {0x1a75, 0x1a7c, 230},
+    {0x1a7f, 0x1a7f, 220}, {0x1ab0, 0x1ab4, 230}, {0x1ab5, 0x1aba, 220}, {0x1abb, 0x1abc, 230}, {0x1abd, 0x1abd, 220},
+    {0x1abf, 0x1ac0, 220}, {0x1ac1, 0x1ac2, 230}, {0x1ac3, 0x1ac4, 220}, {0x1ac5, 0x1ac9, 230}, {0x1aca, 0x1aca, 220},
+    {0x1acb, 0x1ace, 230}, {0x1b34, 0x1b34, 7}, {0x1b44, 0x1b44, 9}, {0x1b6b, 0x1b6b, 230}, {0x1b6c, 0x1b6c, 220},
+    {0x1b6d, 0x1b73, 230}, {0x1baa, 0x1bab, 9}, {0x1be6, 0x1be6, 7}, {0x1bf2, 0x1bf3, 9}, {0x1c37, 0x1c37, 7},
+    {0x1cd0, 0x1cd2, 230}, {0x1cd4, 0x1cd4, 1}, {0x1cd5, 0x1cd9, 220}, {0x1cda, 0x1cdb, 230}, {0x1cdc, 0x1cdf, 220},
+    {0x1ce0, 0x1ce0, 230}, {0x1ce2, 0x1ce8, 1}, {0x1ced, 0x1ced, 220}, {0x1cf4, 0x1cf4, 230}, {0x1cf8, 0x1cf9, 230},
+    {0x1dc0, 0x1dc1, 230}, {0x1dc2, 0x1dc2, 220}, {0x1dc3, 0x1dc9, 230}, {0x1dca, 0x1dca, 220}, {0x1dcb, 0x1dcc, 230},
+    {0x1dcd, 0x1dcd, 234}, {0x1dce, 0x1dce, 214}, {0x1dcf, 0x1dcf, 220}, {0x1dd0, 0x1dd0, 202}, {0x1dd1, 0x1df5, 230},
+    {0x1df6, 0x1df6, 232}, {0x1df7, 0x1df8, 228}, {0x1df9, 0x1df9, 220}, {0x1dfa, 0x1dfa, 218}, {0x1dfb, 0x1dfb, 230},
+    {0x1dfc, 0x1dfc, 233}, {0x1dfd, 0x1dfd, 220}, {0x1dfe, 0x1dfe, 230}, {0x1dff, 0x1dff, 220}, {0x20d0, 0x20d1, 230},
+    {0x20d2, 0x20d3, 1}, {0x20d4, 0x20d7, 230}, {0x20d8, 0x20da, 1}, {0x20db, 0x20dc, 230}, {0x20e1, 0x20e1, 230},
+    {0x20e5, 0x20e6, 1}, {0x20e7, 0x20e7, 230}, {0x20e8, 0x20e8, 220}, {0x20e9, 0x20e9, 230}, {0x20ea, 0x20eb, 1},
+    {0x20ec, 0x20ef, 220}, {0x20f0, 0x20f0, 230}, {0x2cef, 0x2cf1, 230}, {0x2d7f, 0x2d7f, 9}, {0x2de0, 0x2dff, 230},
+    {0x302a, 0x302a, 218}, {0x302b, 0x302b, 228}, {0x302c, 0x302c, 232}, {0x302d, 0x302d, 222}, {0x302e, 0x302f, 224},
+    {0x3099, 0x309a, 8}, {0xa66f, 0xa66f, 230}, {0xa674, 0xa67d, 230}, {0xa69e, 0xa69f, 230}, {0xa6f0, 0xa6f1, 230},
+    {0xa806, 0xa806, 9}, {0xa82c, 0xa82c, 9}, {0xa8c4, 0xa8c4, 9}, {0xa8e0, 0xa8f1, 230}, {0xa92b, 0xa92d, 220},
+    {0xa953, 0xa953, 9}, {0xa9b3, 0xa9b3, 7}, {0xa9c0, 0xa9c0, 9}, {0xaab0, 0xaab0, 230}, {0xaab2, 0xaab3, 230},
+    {0xaab4, 0xaab4, 220}, {0xaab7, 0xaab8, 230}, {0xaabe, 0xaabf, 230}, {0xaac1, 0xaac1, 230}, {0xaaf6, 0xaaf6, 9},
+    {0xabed, 0xabed, 9}, {0xfb1e, 0xfb1e, 26}, {0xfe20, 0xfe26, 230}, {0xfe27, 0xfe2d, 220}, {0xfe2e, 0xfe2f, 230},
+    {0x101fd, 0x101fd, 220}, {0x102e0, 0x102e0, 220}, {0x10376, 0x1037a, 230}, {0x10a0d, 0x10a0d, 220}, {0x10a0f, 0x10a0f, 230},
+    {0x10a38, 0x10a38, 230}, {0x10a39, 0x10a39, 1}, {0x10a3a, 0x10a3a, 220}, {0x10a3f, 0x10a3f, 9}, {0x10ae5, 0x10ae5, 230},
+    {0x10ae6, 0x10ae6, 220}, {0x10d24, 0x10d27, 230}, {0x10eab, 0x10eac, 230}, {0x10f46, 0x10f47, 220}, {0x10f48, 0x10f4a, 230},
+    {0x10f4b, 0x10f4b, 220}, {0x10f4c, 0x10f4c, 230}, {0x10f4d, 0x10f50, 220}, {0x10f82, 0x10f82, 230}, {0x10f83, 0x10f83, 220},
+    {0x10f84, 0x10f84, 230}, {0x10f85, 0x10f85, 220}, {0x11046, 0x11046, 9}, {0x11070, 0x11070, 9}, {0x1107f, 0x1107f, 9},
+    {0x110b9, 0x110b9, 9}, {0x110ba, 0x110ba, 7}, {0x11100, 0x11102, 230}, {0x11133, 0x11134, 9}, {0x11173, 0x11173, 7},
+    {0x111c0, 0x111c0, 9}, {0x111ca, 0x111ca, 7}, {0x11235, 0x11235, 9}, {0x11236, 0x11236, 7}, {0x112e9, 0x112e9, 7},
+    {0x112ea, 0x112ea, 9}, {0x1133b, 0x1133c, 7}, {0x1134d, 0x1134d, 9}, {0x11366, 0x1136c, 230}, {0x11370, 0x11374, 230},
+    {0x11442, 0x11442, 9}, {0x11446, 0x11446, 7}, {0x1145e, 0x1145e, 230}, {0x114c2, 0x114c2, 9}, {0x114c3, 0x114c3, 7},
+    {0x115bf, 0x115bf, 9}, {0x115c0, 0x115c0, 7}, {0x1163f, 0x1163f, 9}, {0x116b6, 0x116b6, 9}, {0x116b7, 0x116b7, 7},
+    {0x1172b, 0x1172b, 9}, {0x11839, 0x11839, 9}, {0x1183a, 0x1183a, 7}, {0x1193d, 0x1193e, 9}, {0x11943, 0x11943, 7},
+    {0x119e0, 0x119e0, 9}, {0x11a34, 0x11a34, 9}, {0x11a47, 0x11a47, 9}, {0x11a99, 0x11a99, 9}, {0x11c3f, 0x11c3f, 9},
+    {0x11d42, 0x11d42, 7}, {0x11d44, 0x11d45, 9}, {0x11d97, 0x11d97, 9}, {0x16af0, 0x16af4, 1}, {0x16b30, 0x16b36, 230},
+    {0x16ff0, 0x16ff1, 6}, {0x1bc9e, 0x1bc9e, 1}, {0x1d165, 0x1d166, 216}, {0x1d167, 0x1d169, 1}, {0x1d16d, 0x1d16d, 226},
+    {0x1d16e, 0x1d172, 216}, {0x1d17b, 0x1d182, 220}, {0x1d185, 0x1d189, 230}, {0x1d18a, 0x1d18b, 220}, {0x1d1aa, 0x1d1ad, 230},
+    {0x1d242, 0x1d244, 230}, {0x1e000, 0x1e006, 230}, {0x1e008, 0x1e018, 230}, {0x1e01b, 0x1e021, 230}, {0x1e023, 0x1e024, 230},
+    {0x1e026, 0x1e02a, 230}, {0x1e130, 0x1e136, 230}, {0x1e2ae, 0x1e2ae, 230}, {0x1e2ec, 0x1e2ef, 230}, {0x1e8d0, 0x1e8d6, 220},
+    {0x1e944, 0x1e949, 230}, {0x1e94a, 0x1e94a, 7},
+}};
+
+struct Decomposition {
+  char32_t cp;
+  uint16_t offset;
+  uint16_t length;
+};
+
+// Full canonical decompositions (Hangul syllables are algorithmic), as
+// slices of decomposition_data.
+constexpr std::array<Decomposition, 2061> decompositions{{
+    {0x00c0, 0, 2}, {0x00c1, 2, 2}, {0x00c2, 4, 2}, {0x00c3, 6, 2}, {0x00c4, 8, 2},
+    {0x00c5, 10, 2}, {0x00c7, 12, 2}, {0x00c8, 14, 2}, {0x00c9, 16, 2}, {0x00ca, 18, 2},
+    {0x00cb, 20, 2}, {0x00cc, 22, 2}, {0x00cd, 24, 2}, {0x00ce, 26, 2}, {0x00cf, 28, 2},
+    {0x00d1, 30, 2}, {0x00d2, 32, 2}, {0x00d3, 34, 2}, {0x00d4, 36, 2}, {0x00d5, 38, 2},
+    {0x00d6, 40, 2}, {0x00d9, 42, 2}, {0x00da, 44, 2}, {0x00db, 46, 2}, {0x00dc, 48, 2},
+    {0x00dd, 50, 2}, {0x00e0, 52, 2}, {0x00e1, 54, 2}, {0x00e2, 56, 2}, {0x00e3, 58, 2},
+    {0x00e4, 60, 2}, {0x00e5, 62, 2}, {0x00e7, 64, 2}, {0x00e8, 66, 2}, {0x00e9, 68, 2},
+    {0x00ea, 70, 2}, {0x00eb, 72, 2}, {0x00ec, 74, 2}, {0x00ed, 76, 2}, {0x00ee, 78, 2},
+    {0x00ef, 80, 2}, {0x00f1, 82, 2}, {0x00f2, 84, 2}, {0x00f3, 86, 2}, {0x00f4, 88, 2},
+    {0x00f5, 90, 2}, {0x00f6, 92, 2}, {0x00f9, 94, 2}, {0x00fa, 96, 2}, {0x00fb, 98, 2},
+    {0x00fc, 100, 2}, {0x00fd, 102, 2}, {0x00ff, 104, 2}, {0x0100, 106, 2}, {0x0101, 108, 2},
+    {0x0102, 110, 2}, {0x0103, 112, 2}, {0x0104, 114, 2}, {0x0105, 116, 2}, {0x0106, 118, 2},
+    {0x0107, 120, 2}, {0x0108, 122, 2}, {0x0109, 124, 2}, {0x010a, 126, 2}, {0x010b, 128, 2},
+    {0x010c, 130, 2}, {0x010d, 132, 2}, {0x010e, 134, 2}, {0x010f, 136, 2}, {0x0112, 138, 2},
+    {0x0113, 140, 2}, {0x0114, 142, 2}, {0x0115, 144, 2}, {0x0116, 146, 2}, {0x0117, 148, 2},
+    {0x0118, 150, 2}, {0x0119, 152, 2}, {0x011a, 154, 2}, {0x011b, 156, 2}, {0x011c, 158, 2},
+    {0x011d, 160, 2}, {0x011e, 162, 2}, {0x011f, 164, 2}, {0x0120, 166, 2}, {0x0121, 168, 2},
+    {0x0122, 170, 2}, {0x0123, 172, 2}, {0x0124, 174, 2}, {0x0125, 176, 2}, {0x0128, 178, 2},
+    {0x0129, 180, 2}, {0x012a, 182, 2}, {0x012b, 184, 2}, {0x012c, 186, 2}, {0x012d, 188, 2},
+    {0x012e, 190, 2}, {0x012f, 192, 2}, {0x0130, 194, 2}, {0x0134, 196, 2}, {0x0135, 198, 2},
+    {0x0136, 200, 2}, {0x0137, 202, 2}, {0x0139, 204, 2}, {0x013a, 206, 2}, {0x013b, 208, 2},
+    {0x013c, 210, 2}, {0x013d, 212, 2}, {0x013e, 214, 2}, {0x0143, 216, 2}, {0x0144, 218, 2},
+    {0x0145, 220, 2}, {0x0146, 222, 2}, {0x0147, 224, 2}, {0x0148, 226, 2}, {0x014c, 228, 2},
+    {0x014d, 230, 2}, {0x014e, 232, 2}, {0x014f, 234, 2}, {0x0150, 236, 2}, {0x0151, 238, 2},
+    {0x0154, 240, 2}, {0x0155, 242, 2}, {0x0156, 244, 2}, {0x0157, 246, 2}, {0x0158, 248, 2},
+    {0x0159, 250, 2}, {0x015a, 252, 2}, {0x015b, 254, 2}, {0x015c, 256, 2}, {0x015d, 258, 2},
+    {0x015e, 260, 2}, {0x015f, 262, 2}, {0x0160, 264, 2}, {0x0161, 266, 2}, {0x0162, 268, 2},
+    {0x0163, 270, 2}, {0x0164, 272, 2}, {0x0165, 274, 2}, {0x0168, 276, 2}, {0x0169, 278, 2},
+    {0x016a, 280, 2}, {0x016b, 282, 2}, {0x016c, 284, 2}, {0x016d, 286, 2}, {0x016e, 288, 2},
+    {0x016f, 290, 2}, {0x0170, 292, 2}, {0x0171, 294, 2}, {0x0172, 296, 2}, {0x0173, 298, 2},
+    {0x0174, 300, 2}, {0x0175, 302, 2}, {0x0176, 304, 2}, {0x0177, 306, 2}, {0x0178, 308, 2},
+    {0x0179, 310, 2}, {0x017a, 312, 2}, {0x017b, 314, 2}, {0x017c, 316, 2}, {0x017d, 318, 2},
+    {0x017e, 320, 2}, {0x01a0, 322, 2}, {0x01a1, 324, 2}, {0x01af, 326, 2}, {0x01b0, 328, 2},
+    {0x01cd, 330, 2}, {0x01ce, 332, 2}, {0x01cf, 334, 2}, {0x01d0, 336, 2}, {0x01d1, 338, 2},
+    {0x01d2, 340, 2}, {0x01d3, 342, 2}, {0x01d4, 344, 2}, {0x01d5, 346, 3}, {0x01d6, 349, 3},
+    {0x01d7, 352, 3}, {0x01d8, 355, 3}, {0x01d9, 358, 3}, {0x01da, 361, 3}, {0x01db, 364, 3},
+    {0x01dc, 367, 3}, {0x01de, 370, 3}, {0x01df, 373, 3}, {0x01e0, 376, 3}, {0x01e1, 379, 3},
+    {0x01e2, 382, 2}, {0x01e3, 384, 2}, {0x01e6, 386, 2}, {0x01e7, 388, 2}, {0x01e8, 390, 2},
+    {0x01e9, 392, 2}, {0x01ea, 394, 2}, {0x01eb, 396, 2}, {0x01ec, 398, 3}, {0x01ed, 401, 3},
+    {0x01ee, 404, 2}, {0x01ef, 406, 2}, {0x01f0, 408, 2}, {0x01f4, 410, 2}, {0x01f5, 412, 2},
+    {0x01f8, 414, 2}, {0x01f9, 416, 2}, {0x01fa, 418, 3}, {0x01fb, 421, 3}, {0x01fc, 424, 2},
+    {0x01fd, 426, 2}, {0x01fe, 428, 2}, {0x01ff, 430, 2}, {0x0200, 432, 2}, {0x0201, 434, 2},
+    {0x0202, 436, 2}, {0x0203, 438, 2}, {0x0204, 440, 2}, {0x0205, 442, 2}, {0x0206, 444, 2},
+    {0x0207, 446, 2}, {0x0208, 448, 2}, {0x0209, 450, 2}, {0x020a, 452, 2}, {0x020b, 454, 2},
+    {0x020c, 456, 2}, {0x020d, 458, 2}, {0x020e, 460, 2}, {0x020f, 462, 2}, {0x0210, 464, 2},
+    {0x0211, 466, 2}, {0x0212, 468, 2}, {0x0213, 470, 2}, {0x0214, 472, 2}, {0x0215, 474, 2},
+    {0x0216, 476, 2}, {0x0217, 478, 2}, {0x0218, 480, 2}, {0x0219, 482, 2}, {0x021a, 484, 2},
+    {0x021b, 486, 2}, {0x021e, 488, 2}, {0x021f, 490, 2}, {0x0226, 492, 2}, {0x0227, 494, 2},
+    {0x0228, 496, 2}, {0x0229, 498, 2}, {0x022a, 500, 3}, {0x022b, 503, 3}, {0x022c, 506, 3},
+    {0x022d, 509, 3}, {0x022e, 512, 2}, {0x022f, 514, 2}, {0x0230, 516, 3}, {0x0231, 519, 3},
+    {0x0232, 522, 2}, {0x0233, 524, 2}, {0x0340, 526, 1}, {0x0341, 527, 1}, {0x0343, 528, 1},
+    {0x0344, 529, 2}, {0x0374, 531, 1}, {0x037e, 532, 1}, {0x0385, 533, 2}, {0x0386, 535, 2},
+    {0x0387, 537, 1}, {0x0388, 538, 2}, {0x0389, 540, 2}, {0x038a, 542, 2}, {0x038c, 544, 2},
+    {0x038e, 546, 2}, {0x038f, 548, 2}, {0x0390, 550, 3}, {0x03aa, 553, 2}, {0x03ab, 555, 2},
+    {0x03ac, 557, 2}, {0x03ad, 559, 2}, {0x03ae, 561, 2}, {0x03af, 563, 2}, {0x03b0, 565, 3},
+    {0x03ca, 568, 2}, {0x03cb, 570, 2}, {0x03cc, 572, 2}, {0x03cd, 574, 2}, {0x03ce, 576, 2},
+    {0x03d3, 578, 2}, {0x03d4, 580, 2}, {0x0400, 582, 2}, {0x0401, 584, 2}, {0x0403, 586, 2},
+    {0x0407, 588, 2}, {0x040c, 590, 2}, {0x040d, 592, 2}, {0x040e, 594, 2}, {0x0419, 596, 2},
+    {0x0439, 598, 2}, {0x0450, 600, 2}, {0x0451, 602, 2}, {0x0453, 604, 2}, {0x0457, 606, 2},
+    {0x045c, 608, 2}, {0x045d, 610, 2}, {0x045e, 612, 2}, {0x0476, 614, 2}, {0x0477, 616, 2},
+    {0x04c1, 618, 2}, {0x04c2, 620, 2}, {0x04d0, 622, 2}, {0x04d1, 624, 2}, {0x04d2, 626, 2},
+    {0x04d3, 628, 2}, {0x04d6, 630, 2}, {0x04d7, 632, 2}, {0x04da, 634, 2}, {0x04db, 636, 2},
+    {0x04dc, 638, 2}, {0x04dd, 640, 2}, {0x04de, 642, 2}, {0x04df, 644, 2}, {0x04e2, 646, 2},
+    {0x04e3, 648, 2}, {0x04e4, 650, 2}, {0x04e5, 652, 2}, {0x04e6, 654, 2}, {0x04e7, 656, 2},
+    {0x04ea, 658, 2}, {0x04eb, 660, 2}, {0x04ec, 662, 2}, {0x04ed, 664, 2}, {0x04ee, 666, 2},
+    {0x04ef, 668, 2}, {0x04f0, 670, 2}, {0x04f1, 672, 2}, {0x04f2, 674, 2}, {0x04f3, 676, 2},
+    {0x04f4, 678, 2}, {0x04f5, 680, 2}, {0x04f8, 682, 2}, {0x04f9, 684, 2}, {0x0622, 686, 2},
+    {0x0623, 688, 2}, {0x0624, 690, 2}, {0x0625, 692, 2}, {0x0626, 694, 2}, {0x06c0, 696, 2},
+    {0x06c2, 698, 2}, {0x06d3, 700, 2}, {0x0929, 702, 2}, {0x0931, 704, 2}, {0x0934, 706, 2},
+    {0x0958, 708, 2}, {0x0959, 710, 2}, {0x095a, 712, 2}, {0x095b, 714, 2}, {0x095c, 716, 2},
+    {0x095d, 718, 2}, {0x095e, 720, 2}, {0x095f, 722, 2}, {0x09cb, 724, 2}, {0x09cc, 726, 2},
+    {0x09dc, 728, 2}, {0x09dd, 730, 2}, {0x09df, 732, 2}, {0x0a33, 734, 2}, {0x0a36, 736, 2},
+    {0x0a59, 738, 2}, {0x0a5a, 740, 2}, {0x0a5b, 742, 2}, {0x0a5e, 744, 2}, {0x0b48, 746, 2},
+    {0x0b4b, 748, 2}, {0x0b4c, 750, 2}, {0x0b5c, 752, 2}, {0x0b5d, 754, 2}, {0x0b94, 756, 2},
+    {0x0bca, 758, 2}, {0x0bcb, 760, 2}, {0x0bcc, 762, 2}, {0x0c48, 764, 2}, {0x0cc0, 766, 2},
+    {0x0cc7, 768, 2}, {0x0cc8, 770, 2}, {0x0cca, 772, 2}, {0x0ccb, 774, 3}, {0x0d4a, 777, 2},
+    {0x0d4b, 779, 2}, {0x0d4c, 781, 2}, {0x0dda, 783, 2}, {0x0ddc, 785, 2}, {0x0ddd, 787, 3},
+    {0x0dde, 790, 2}, {0x0f43, 792, 2}, {0x0f4d, 794, 2}, {0x0f52, 796, 2}, {0x0f57, 798, 2},
+    {0x0f5c, 800, 2}, {0x0f69, 802, 2}, {0x0f73, 804, 2}, {0x0f75, 806, 2}, {0x0f76, 808, 2},
+    {0x0f78, 810, 2}, {0x0f81, 812, 2}, {0x0f93, 814, 2}, {0x0f9d, 816, 2}, {0x0fa2, 818, 2},
+    {0x0fa7, 820, 2}, {0x0fac, 822, 2}, {0x0fb9, 824, 2}, {0x1026, 826, 2}, {0x1b06, 828, 2},
+    {0x1b08, 830, 2}, {0x1b0a, 832, 2}, {0x1b0c, 834, 2}, {0x1b0e, 836, 2}, {0x1b12, 838, 2},
+    {0x1b3b, 840, 2}, {0x1b3d, 842, 2}, {0x1b40, 844, 2}, {0x1b41, 846, 2}, {0x1b43, 848, 2},
+    {0x1e00, 850, 2}, {0x1e01, 852, 2}, {0x1e02, 854, 2}, {0x1e03, 856, 2}, {0x1e04, 858, 2},
+    {0x1e05, 860, 2}, {0x1e06, 862, 2}, {0x1e07, 864, 2}, {0x1e08, 866, 3}, {0x1e09, 869, 3},
+    {0x1e0a, 872, 2}, {0x1e0b, 874, 2}, {0x1e0c, 876, 2}, {0x1e0d, 878, 2}, {0x1e0e, 880, 2},
+    {0x1e0f, 882, 2}, {0x1e10, 884, 2}, {0x1e11, 886, 2}, {0x1e12, 888, 2}, {0x1e13, 890, 2},
+    {0x1e14, 892, 3}, {0x1e15, 895, 3}, {0x1e16, 898, 3}, {0x1e17, 901, 3}, {0x1e18, 904, 2},
+    {0x1e19, 906, 2}, {0x1e1a, 908, 2}, {0x1e1b, 910, 2}, {0x1e1c, 912, 3}, {0x1e1d, 915, 3},
+    {0x1e1e, 918, 2}, {0x1e1f, 920, 2}, {0x1e20, 922, 2}, {0x1e21, 924, 2}, {0x1e22, 926, 2},
+    {0x1e23, 928, 2}, {0x1e24, 930, 2}, {0x1e25, 932, 2}, {0x1e26, 934, 2}, {0x1e27, 936, 2},
+    {0x1e28, 938, 2}, {0x1e29, 940, 2}, {0x1e2a, 942, 2}, {0x1e2b, 944, 2}, {0x1e2c, 946, 2},
+    {0x1e2d, 948, 2}, {0x1e2e, 950, 3}, {0x1e2f, 953, 3}, {0x1e30, 956, 2}, {0x1e31, 958, 2},
+    {0x1e32, 960, 2}, {0x1e33, 962, 2}, {0x1e34, 964, 2}, {0x1e35, 966, 2}, {0x1e36, 968, 2},
+    {0x1e37, 970, 2}, {0x1e38, 972, 3}, {0x1e39, 975, 3}, {0x1e3a, 978, 2}, {0x1e3b, 980, 2},
+    {0x1e3c, 982, 2}, {0x1e3d, 984, 2}, {0x1e3e, 986, 2}, {0x1e3f, 988, 2}, {0x1e40, 990, 2},
+    {0x1e41, 992, 2}, {0x1e42, 994, 2}, {0x1e43, 996, 2}, {0x1e44, 998, 2}, {0x1e45, 1000, 2},
+    {0x1e46, 1002, 2}, {0x1e47, 1004, 2}, {0x1e48, 1006, 2}, {0x1e49, 1008, 2}, {0x1e4a, 1010, 2},
+    {0x1e4b, 1012, 2}, {0x1e4c, 1014, 3}, {0x1e4d, 1017, 3}, {0x1e4e, 1020, 3}, {0x1e4f, 1023, 3},
+    {0x1e50, 1026, 3}, {0x1e51, 1029, 3}, {0x1e52, 1032, 3}, {0x1e53, 1035, 3}, {0x1e54, 1038, 2},
+    {0x1e55, 1040, 2}, {0x1e56, 1042, 2}, {0x1e57, 1044, 2}, {0x1e58, 1046, 2}, {0x1e59, 1048, 2},
+    {0x1e5a, 1050, 2}, {0x1e5b, 1052, 2}, {0x1e5c, 1054, 3}, {0x1e5d, 1057, 3}, {0x1e5e, 1060, 2},
+    {0x1e5f, 1062, 2}, {0x1e60, 1064, 2}, {0x1e61, 1066, 2}, {0x1e62, 1068, 2}, {0x1e63, 1070, 2},
+    {0x1e64, 1072, 3}, {0x1e65, 1075, 3}, {0x1e66, 1078, 3}, {0x1e67, 1081, 3}, {0x1e68, 1084, 3},
+    {0x1e69, 1087, 3}, {0x1e6a, 1090, 2}, {0x1e6b, 1092, 2}, {0x1e6c, 1094, 2}, {0x1e6d, 1096, 2},
+    {0x1e6e, 1098, 2}, {0x1e6f, 1100, 2}, {0x1e70, 1102, 2}, {0x1e71, 1104, 2}, {0x1e72, 1106, 2},
+    {0x1e73, 1108, 2}, {0x1e74, 1110, 2}, {0x1e75, 1112, 2}, {0x1e76, 1114, 2}, {0x1e77, 1116, 2},
+    {0x1e78, 1118, 3}, {0x1e79, 1121, 3}, {0x1e7a, 1124, 3}, {0x1e7b, 1127, 3}, {0x1e7c, 1130, 2},
+    {0x1e7d, 1132, 2}, {0x1e7e, 1134, 2}, {0x1e7f, 1136, 2}, {0x1e80, 1138, 2}, {0x1e81, 1140, 2},
+    {0x1e82, 1142, 2}, {0x1e83, 1144, 2}, {0x1e84, 1146, 2}, {0x1e85, 1148, 2}, {0x1e86, 1150, 2},
+    {0x1e87, 1152, 2}, {0x1e88, 1154, 2}, {0x1e89, 1156, 2}, {0x1e8a, 1158, 2}, {0x1e8b, 1160, 2},
+    {0x1e8c, 1162, 2}, {0x1e8d, 1164, 2}, {0x1e8e, 1166, 2}, {0x1e8f, 1168, 2}, {0x1e90, 1170, 2},
+    {0x1e91, 1172, 2}, {0x1e92, 1174, 2}, {0x1e93, 1176, 2}, {0x1e94, 1178, 2}, {0x1e95, 1180, 2},
+    {0x1e96, 1182, 2}, {0x1e97, 1184, 2}, {0x1e98, 1186, 2}, {0x1e99, 1188, 2}, {0x1e9b, 1190, 2},
+    {0x1ea0, 1192, 2}, {0x1ea1, 1194, 2}, {0x1ea2, 1196, 2}, {0x1ea3, 1198, 2}, {0x1ea4, 1200, 3},
+    {0x1ea5, 1203, 3}, {0x1ea6, 1206, 3}, {0x1ea7, 1209, 3}, {0x1ea8, 1212, 3}, {0x1ea9, 1215, 3},
+    {0x1eaa, 1218, 3}, {0x1eab, 1221, 3}, {0x1eac, 1224, 3}, {0x1ead, 1227, 3}, {0x1eae, 1230, 3},
+    {0x1eaf, 1233, 3}, {0x1eb0, 1236, 3}, {0x1eb1, 1239, 3}, {0x1eb2, 1242, 3}, {0x1eb3, 1245, 3},
+    {0x1eb4, 1248, 3}, {0x1eb5, 1251, 3}, {0x1eb6, 1254, 3}, {0x1eb7, 1257, 3}, {0x1eb8, 1260, 2},
+    {0x1eb9, 1262, 2}, {0x1eba, 1264, 2}, {0x1ebb, 1266, 2}, {0x1ebc, 1268, 2}, {0x1ebd, 1270, 2},
+    {0x1ebe, 1272, 3}, {0x1ebf, 1275, 3}, {0x1ec0, 1278, 3}, {0x1ec1, 1281, 3}, {0x1ec2, 1284, 3},
+    {0x1ec3, 1287, 3}, {0x1ec4, 1290, 3}, {0x1ec5, 1293, 3}, {0x1ec6, 1296, 3}, {0x1ec7, 1299, 3},
+    {0x1ec8, 1302, 2}, {0x1ec9, 1304, 2}, {0x1eca, 1306, 2}, {0x1ecb, 1308, 2}, {0x1ecc, 1310, 2},
+    {0x1ecd, 1312, 2}, {0x1ece, 1314, 2}, {0x1ecf, 1316, 2}, {0x1ed0, 1318, 3}, {0x1ed1, 1321, 3},
+    {0x1ed2, 1324, 3}, {0x1ed3, 1327, 3}, {0x1ed4, 1330, 3}, {0x1ed5, 1333, 3}, {0x1ed6, 1336, 3},
+    {0x1ed7, 1339, 3}, {0x1ed8, 1342, 3}, {0x1ed9, 1345, 3}, {0x1eda, 1348, 3}, {0x1edb, 1351, 3},
+    {0x1edc, 1354, 3}, {0x1edd, 1357, 3}, {0x1ede, 1360, 3}, {0x1edf, 1363, 3}, {0x1ee0, 1366, 3},
+    {0x1ee1, 1369, 3}, {0x1ee2, 1372, 3}, {0x1ee3, 1375, 3}, {0x1ee4, 1378, 2}, {0x1ee5, 1380, 2},
+    {0x1ee6, 1382, 2}, {0x1ee7, 1384, 2}, {0x1ee8, 1386, 3}, {0x1ee9, 1389, 3}, {0x1eea, 1392, 3},
+    {0x1eeb, 1395, 3}, {0x1eec, 1398, 3}, {0x1eed, 1401, 3}, {0x1eee, 1404, 3}, {0x1eef, 1407, 3},
+    {0x1ef0, 1410, 3}, {0x1ef1, 1413, 3}, {0x1ef2, 1416, 2}, {0x1ef3, 1418, 2}, {0x1ef4, 1420, 2},
+    {0x1ef5, 1422, 2}, {0x1ef6, 1424, 2}, {0x1ef7, 1426, 2}, {0x1ef8, 1428, 2}, {0x1ef9, 1430, 2},
+    {0x1f00, 1432, 2}, {0x1f01, 1434, 2}, {0x1f02, 1436, 3}, {0x1f03, 1439, 3}, {0x1f04, 1442, 3},
+    {0x1f05, 1445, 3}, {0x1f06, 1448, 3}, {0x1f07, 1451, 3}, {0x1f08, 1454, 2}, {0x1f09, 1456, 2},
+    {0x1f0a, 1458, 3}, {0x1f0b, 1461, 3}, {0x1f0c, 1464, 3}, {0x1f0d, 1467, 3}, {0x1f0e, 1470, 3},
+    {0x1f0f, 1473, 3}, {0x1f10, 1476, 2}, {0x1f11, 1478, 2}, {0x1f12, 1480, 3}, {0x1f13, 1483, 3},
+    {0x1f14, 1486, 3}, {0x1f15, 1489, 3}, {0x1f18, 1492, 2}, {0x1f19, 1494, 2}, {0x1f1a, 1496, 3},
+    {0x1f1b, 1499, 3}, {0x1f1c, 1502, 3}, {0x1f1d, 1505, 3}, {0x1f20, 1508, 2}, {0x1f21, 1510, 2},
+    {0x1f22, 1512, 3}, {0x1f23, 1515, 3}, {0x1f24, 1518, 3}, {0x1f25, 1521, 3}, {0x1f26, 1524, 3},
+    {0x1f27, 1527, 3}, {0x1f28, 1530, 2}, {0x1f29, 1532, 2}, {0x1f2a, 1534, 3}, {0x1f2b, 1537, 3},
+    {0x1f2c, 1540, 3}, {0x1f2d, 1543, 3}, {0x1f2e, 1546, 3}, {0x1f2f, 1549, 3}, {0x1f30, 1552, 2},
+    {0x1f31, 1554, 2}, {0x1f32, 1556, 3}, {0x1f33, 1559, 3}, {0x1f34, 1562, 3}, {0x1f35, 1565, 3},
+    {0x1f36, 1568, 3}, {0x1f37, 1571, 3}, {0x1f38, 1574, 2}, {0x1f39, 1576, 2}, {0x1f3a, 1578, 3},
+    {0x1f3b, 1581, 3}, {0x1f3c, 1584, 3}, {0x1f3d, 1587, 3}, {0x1f3e, 1590, 3}, {0x1f3f, 1593, 3},
+    {0x1f40, 1596, 2}, {0x1f41, 1598, 2}, {0x1f42, 1600, 3}, {0x1f43, 1603, 3}, {0x1f44, 1606, 3},
+    {0x1f45, 1609, 3}, {0x1f48, 1612, 2}, {0x1f49, 1614, 2}, {0x1f4a, 1616, 3}, {0x1f4b, 1619, 3},
+    {0x1f4c, 1622, 3}, {0x1f4d, 1625, 3}, {0x1f50, 1628, 2}, {0x1f51, 1630, 2}, {0x1f52, 1632, 3},
+    {0x1f53, 1635, 3}, {0x1f54, 1638, 3}, {0x1f55, 1641, 3}, {0x1f56, 1644, 3}, {0x1f57, 1647, 3},
+    {0x1f59, 1650, 2}, {0x1f5b, 1652, 3}, {0x1f5d, 1655, 3}, {0x1f5f, 1658, 3}, {0x1f60, 1661, 2},
+    {0x1f61, 1663, 2}, {0x1f62, 1665, 3}, {0x1f63, 1668, 3}, {0x1f64, 1671, 3}, {0x1f65, 1674, 3},
+    {0x1f66, 1677, 3}, {0x1f67, 1680, 3}, {0x1f68, 1683, 2}, {0x1f69, 1685, 2}, {0x1f6a, 1687, 3},
+    {0x1f6b, 1690, 3}, {0x1f6c, 1693, 3}, {0x1f6d, 1696, 3}, {0x1f6e, 1699, 3}, {0x1f6f, 1702, 3},
+    {0x1f70, 1705, 2}, {0x1f71, 1707, 2}, {0x1f72, 1709, 2}, {0x1f73, 1711, 2}, {0x1f74, 1713, 2},
+    {0x1f75, 1715, 2}, {0x1f76, 1717, 2}, {0x1f77, 1719, 2}, {0x1f78, 1721, 2}, {0x1f79, 1723, 2},
+    {0x1f7a, 1725, 2}, {0x1f7b, 1727, 2}, {0x1f7c, 1729, 2}, {0x1f7d, 1731, 2}, {0x1f80, 1733, 3},
+    {0x1f81, 1736, 3}, {0x1f82, 1739, 4}, {0x1f83, 1743, 4}, {0x1f84, 1747, 4}, {0x1f85, 1751, 4},
+    {0x1f86, 1755, 4}, {0x1f87, 1759, 4}, {0x1f88, 1763, 3}, {0x1f89, 1766, 3}, {0x1f8a, 1769, 4},
+    {0x1f8b, 1773, 4}, {0x1f8c, 1777, 4}, {0x1f8d, 1781, 4}, {0x1f8e, 1785, 4}, {0x1f8f, 1789, 4},
+    {0x1f90, 1793, 3}, {0x1f91, 1796, 3}, {0x1f92, 1799, 4}, {0x1f93, 1803, 4}, {0x1f94, 1807, 4},
+    {0x1f95, 1811, 4}, {0x1f96, 1815, 4}, {0x1f97, 1819, 4}, {0x1f98, 1823, 3}, {0x1f99, 1826, 3},
+    {0x1f9a, 1829, 4}, {0x1f9b, 1833, 4}, {0x1f9c, 1837, 4}, {0x1f9d, 1841, 4}, {0x1f9e, 1845, 4},
+    {0x1f9f, 1849, 4}, {0x1fa0, 1853, 3}, {0x1fa1, 1856, 3}, {0x1fa2, 1859, 4}, {0x1fa3, 1863, 4},
+    {0x1fa4, 1867, 4}, {0x1fa5, 1871, 4}, {0x1fa6, 1875, 4}, {0x1fa7, 1879, 4}, {0x1fa8, 1883, 3},
+    {0x1fa9, 1886, 3}, {0x1faa, 1889, 4}, {0x1fab, 1893, 4}, {0x1fac, 1897, 4}, {0x1fad, 1901, 4},
+    {0x1fae, 1905, 4}, {0x1faf, 1909, 4}, {0x1fb0, 1913, 2}, {0x1fb1, 1915, 2}, {0x1fb2, 1917, 3},
+    {0x1fb3, 1920, 2}, {0x1fb4, 1922, 3}, {0x1fb6, 1925, 2}, {0x1fb7, 1927, 3}, {0x1fb8, 1930, 2},
+    {0x1fb9, 1932, 2}, {0x1fba, 1934, 2}, {0x1fbb, 1936, 2}, {0x1fbc, 1938, 2}, {0x1fbe, 1940, 1},
+    {0x1fc1, 1941, 2}, {0x1fc2, 1943, 3}, {0x1fc3, 1946, 2}, {0x1fc4, 1948, 3}, {0x1fc6, 1951, 2},
+    {0x1fc7, 1953, 3}, {0x1fc8, 1956, 2}, {0x1fc9, 1958, 2}, {0x1fca, 1960, 2}, {0x1fcb, 1962, 2},
+    {0x1fcc, 1964, 2}, {0x1fcd, 1966, 2}, {0x1fce, 1968, 2}, {0x1fcf, 1970, 2}, {0x1fd0, 1972, 2},
+    {0x1fd1, 1974, 2}, {0x1fd2, 1976, 3}, {0x1fd3, 1979, 3}, {0x1fd6, 1982, 2}, {0x1fd7, 1984, 3},
+    {0x1fd8, 1987, 2}, {0x1fd9, 1989, 2}, {0x1fda, 1991, 2}, {0x1fdb, 1993, 2}, {0x1fdd, 1995, 2},
+    {0x1fde, 1997, 2}, {0x1fdf, 1999, 2}, {0x1fe0, 2001, 2}, {0x1fe1, 2003, 2}, {0x1fe2, 2005, 3},
+    {0x1fe3, 2008, 3}, {0x1fe4, 2011, 2}, {0x1fe5, 2013, 2}, {0x1fe6, 2015, 2}, {0x1fe7, 2017, 3},
+    {0x1fe8, 2020, 2}, {0x1fe9, 2022, 2}, {0x1fea, 2024, 2}, {0x1feb, 2026, 2}, {0x1fec, 2028, 2},
+    {0x1fed, 2030, 2}, {0x1fee, 2032, 2}, {0x1fef, 2034, 1}, {0x1ff2, 2035, 3}, {0x1ff3, 2038, 2},
+    {0x1ff4, 2040, 3}, {0x1ff6, 2043, 2}, {0x1ff7, 2045, 3}, {0x1ff8, 2048, 2}, {0x1ff9, 2050, 2},
+    {0x1ffa, 2052, 2}, {0x1ffb, 2054, 2}, {0x1ffc, 2056, 2}, {0x1ffd, 2058, 1}, {0x2000, 2059, 1},
+    {0x2001, 2060, 1}, {0x2126, 2061, 1}, {0x212a, 2062, 1}, {0x212b, 2063, 2}, {0x219a, 2065, 2},
+    {0x219b, 2067, 2}, {0x21ae, 2069, 2}, {0x21cd, 2071, 2}, {0x21ce, 2073, 2}, {0x21cf, 2075, 2},
+    {0x2204, 2077, 2}, {0x2209, 2079, 2}, {0x220c, 2081, 2}, {0x2224, 2083, 2}, {0x2226, 2085, 2},
+    {0x2241, 2087, 2}, {0x2244, 2089, 2}, {0x2247, 2091, 2}, {0x2249, 2093, 2}, {0x2260, 2095, 2},
+    {0x2262, 2097, 2}, {0x226d, 2099, 2}, {0x226e, 2101, 2}, {0x226f, 2103, 2}, {0x2270, 2105, 2},
+    {0x2271, 2107, 2}, {0x2274, 2109, 2}, {0x2275, 2111, 2}, {0x2278, 2113, 2}, {0x2279, 2115, 2},
+    {0x2280, 2117, 2}, {0x2281, 2119, 2}, {0x2284, 2121, 2}, {0x2285, 2123, 2}, {0x2288, 2125, 2},
+    {0x2289, 2127, 2}, {0x22ac, 2129, 2}, {0x22ad, 2131, 2}, {0x22ae, 2133, 2}, {0x22af, 2135, 2},
+    {0x22e0, 2137, 2}, {0x22e1, 2139, 2}, {0x22e2, 2141, 2}, {0x22e3, 2143, 2}, {0x22ea, 2145, 2},
+    {0x22eb, 2147, 2}, {0x22ec, 2149, 2}, {0x22ed, 2151, 2}, {0x2329, 2153, 1}, {0x232a, 2154, 1},
+    {0x2adc, 2155, 2}, {0x304c, 2157, 2}, {0x304e, 2159, 2}, {0x3050, 2161, 2}, {0x3052, 2163, 2},
+    {0x3054, 2165, 2}, {0x3056, 2167, 2}, {0x3058, 2169, 2}, {0x305a, 2171, 2}, {0x305c, 2173, 2},
+    {0x305e, 2175, 2}, {0x3060, 2177, 2}, {0x3062, 2179, 2}, {0x3065, 2181, 2}, {0x3067, 2183, 2},
+    {0x3069, 2185, 2}, {0x3070, 2187, 2}, {0x3071, 2189, 2}, {0x3073, 2191, 2}, {0x3074, 2193, 2},
+    {0x3076, 2195, 2}, {0x3077, 2197, 2}, {0x3079, 2199, 2}, {0x307a, 2201, 2}, {0x307c, 2203, 2},
+    {0x307d, 2205, 2}, {0x3094, 2207, 2}, {0x309e, 2209, 2}, {0x30ac, 2211, 2}, {0x30ae, 2213, 2},
+    {0x30b0, 2215, 2}, {0x30b2, 2217, 2}, {0x30b4, 2219, 2}, {0x30b6, 2221, 2}, {0x30b8, 2223, 2},
+    {0x30ba, 2225, 2}, {0x30bc, 2227, 2}, {0x30be, 2229, 2}, {0x30c0, 2231, 2}, {0x30c2, 2233, 2},
+    {0x30c5, 2235, 2}, {0x30c7, 2237, 2}, {0x30c9, 2239, 2}, {0x30d0, 2241, 2}, {0x30d1, 2243, 2},
+    {0x30d3, 2245, 2}, {0x30d4, 2247, 2}, {0x30d6, 2249, 2}, {0x30d7, 2251, 2}, {0x30d9, 2253, 2},
+    {0x30da, 2255, 2}, {0x30dc, 2257, 2}, {0x30dd, 2259, 2}, {0x30f4, 2261, 2}, {0x30f7, 2263, 2},
+    {0x30f8, 2265, 2}, {0x30f9, 2267, 2}, {0x30fa, 2269, 2}, {0x30fe, 2271, 2}, {0xf900, 2273, 1},
+    {0xf901, 2274, 1}, {0xf902, 2275, 1}, {0xf903, 2276, 1}, {0xf904, 2277, 1}, {0xf905, 2278, 1},
+    {0xf906, 2279, 1}, {0xf907, 2280, 1}, {0xf908, 2281, 1}, {0xf909, 2282, 1}, {0xf90a, 2283, 1},
+    {0xf90b, 2284, 1}, {0xf90c, 2285, 1}, {0xf90d, 2286, 1}, {0xf90e, 2287, 1}, {0xf90f, 2288, 1},
+    {0xf910, 2289, 1}, {0xf911, 2290, 1}, {0xf912, 2291, 1}, {0xf913, 2292, 1}, {0xf914, 2293, 1},
+    {0xf915, 2294, 1}, {0xf916, 2295, 1}, {0xf917, 2296, 1}, {0xf918, 2297, 1}, {0xf919, 2298, 1},
+    {0xf91a, 2299, 1}, {0xf91b, 2300, 1}, {0xf91c, 2301, 1}, {0xf91d, 2302, 1}, {0xf91e, 2303, 1},
+    {0xf91f, 2304, 1}, {0xf920, 2305, 1}, {0xf921, 2306, 1}, {0xf922, 2307, 1}, {0xf923, 2308, 1},
+    {0xf924, 2309, 1}, {0xf925, 2310, 1}, {0xf926, 2311, 1}, {0xf927, 2312, 1}, {0xf928, 2313, 1},
+    {0xf929, 2314, 1}, {0xf92a, 2315, 1}, {0xf92b, 2316, 1}, {0xf92c, 2317, 1}, {0xf92d, 2318, 1},
+    {0xf92e, 2319, 1}, {0xf92f, 2320, 1}, {0xf930, 2321, 1}, {0xf931, 2322, 1}, {0xf932, 2323, 1},
+    {0xf933, 2324, 1}, {0xf934, 2325, 1}, {0xf935, 2326, 1}, {0xf936, 2327, 1}, {0xf937, 2328, 1},
+    {0xf938, 2329, 1}, {0xf939, 2330, 1}, {0xf93a, 2331, 1}, {0xf93b, 2332, 1}, {0xf93c, 2333, 1},
+    {0xf93d, 2334, 1}, {0xf93e, 2335, 1}, {0xf93f, 2336, 1}, {0xf940, 2337, 1}, {0xf941, 2338, 1},
+    {0xf942, 2339, 1}, {0xf943, 2340, 1}, {0xf944, 2341, 1}, {0xf945, 2342, 1}, {0xf946, 2343, 1},
+    {0xf947, 2344, 1}, {0xf948, 2345, 1}, {0xf949, 2346, 1}, {0xf94a, 2347, 1}, {0xf94b, 2348, 1},
+    {0xf94c, 2349, 1}, {0xf94d, 2350, 1}, {0xf94e, 2351, 1}, {0xf94f, 2352, 1}, {0xf950, 2353, 1},
+    {0xf951, 2354, 1}, {0xf952, 2355, 1}, {0xf953, 2356, 1}, {0xf954, 2357, 1}, {0xf955, 2358, 1},
+    {0xf956, 2359, 1}, {0xf957, 2360, 1}, {0xf958, 2361, 1}, {0xf959, 2362, 1}, {0xf95a, 2363, 1},
+    {0xf95b, 2364, 1}, {0xf95c, 2365, 1}, {0xf95d, 2366, 1}, {0xf95e, 2367, 1}, {0xf95f, 2368, 1},
+    {0xf960, 2369, 1}, {0xf961, 2370, 1}, {0xf962, 2371, 1}, {0xf963, 2372, 1}, {0xf964, 2373, 1},
+    {0xf965, 2374, 1}, {0xf966, 2375, 1}, {0xf967, 2376, 1}, {0xf968, 2377, 1}, {0xf969, 2378, 1},
+    {0xf96a, 2379, 1}, {0xf96b, 2380, 1}, {0xf96c, 2381, 1}, {0xf96d, 2382, 1}, {0xf96e, 2383, 1},
+    {0xf96f, 2384, 1}, {0xf970, 2385, 1}, {0xf971, 2386, 1}, {0xf972, 2387, 1}, {0xf973, 2388, 1},
+    {0xf974, 2389, 1}, {0xf975, 2390, 1}, {0xf976, 2391, 1}, {0xf977, 2392, 1}, {0xf978, 2393, 1},
+    {0xf979, 2394, 1}, {0xf97a, 2395, 1}, {0xf97b, 2396, 1}, {0xf97c, 2397, 1}, {0xf97d, 2398, 1},
+    {0xf97e, 2399, 1}, {0xf97f, 2400, 1}, {0xf980, 2401, 1}, {0xf981, 2402, 1}, {0xf982, 2403, 1},
+    {0xf983, 2404, 1}, {0xf984, 2405, 1}, {0xf985, 2406, 1}, {0xf986, 2407, 1}, {0xf987, 2408, 1},
+    {0xf988, 2409, 1}, {0xf989, 2410, 1}, {0xf98a, 2411, 1}, {0xf98b, 2412, 1}, {0xf98c, 2413, 1},
+    {0xf98d, 2414, 1}, {0xf98e, 2415, 1}, {0xf98f, 2416, 1}, {0xf990, 2417, 1}, {0xf991, 2418, 1},
+    {0xf992, 2419, 1}, {0xf993, 2420, 1}, {0xf994, 2421, 1}, {0xf995, 2422, 1}, {0xf996, 2423, 1},
+    {0xf997, 2424, 1}, {0xf998, 2425, 1}, {0xf999, 2426, 1}, {0xf99a, 2427, 1}, {0xf99b, 2428, 1},
+    {0xf99c, 2429, 1}, {0xf99d, 2430, 1}, {0xf99e, 2431, 1}, {0xf99f, 2432, 1}, {0xf9a0, 2433, 1},
+    {0xf9a1, 2434, 1}, {0xf9a2, 2435, 1}, {0xf9a3, 2436, 1}, {0xf9a4, 2437, 1}, {0xf9a5, 2438, 1},
+    {0xf9a6, 2439, 1}, {0xf9a7, 2440, 1}, {0xf9a8, 2441, 1}, {0xf9a9, 2442, 1}, {0xf9aa, 2443, 1},
+    {0xf9ab, 2444, 1}, {0xf9ac, 2445, 1}, {0xf9ad, 2446, 1}, {0xf9ae, 2447, 1}, {0xf9af, 2448, 1},
+    {0xf9b0, 2449, 1}, {0xf9b1, 2450, 1}, {0xf9b2, 2451, 1}, {0xf9b3, 2452, 1}, {0xf9b4, 2453, 1},
+    {0xf9b5, 2454, 1}, {0xf9b6, 2455, 1}, {0xf9b7, 2456, 1}, {0xf9b8, 2457, 1}, {0xf9b9, 2458, 1},
+    {0xf9ba, 2459, 1}, {0xf9bb, 2460, 1}, {0xf9bc, 2461, 1}, {0xf9bd, 2462, 1}, {0xf9be, 2463, 1},
+    {0xf9bf, 2464, 1}, {0xf9c0, 2465, 1}, {0xf9c1, 2466, 1}, {0xf9c2, 2467, 1}, {0xf9c3, 2468, 1},
+    {0xf9c4, 2469, 1}, {0xf9c5, 2470, 1}, {0xf9c6, 2471, 1}, {0xf9c7, 2472, 1}, {0xf9c8, 2473, 1},
+    {0xf9c9, 2474, 1}, {0xf9ca, 2475, 1}, {0xf9cb, 2476, 1}, {0xf9cc, 2477, 1}, {0xf9cd, 2478, 1},
+    {0xf9ce, 2479, 1}, {0xf9cf, 2480, 1}, {0xf9d0, 2481, 1}, {0xf9d1, 2482, 1}, {0xf9d2, 2483, 1},
+    {0xf9d3, 2484, 1}, {0xf9d4, 2485, 1}, {0xf9d5, 2486, 1}, {0xf9d6, 2487, 1}, {0xf9d7, 2488, 1},
+    {0xf9d8, 2489, 1}, {0xf9d9, 2490, 1}, {0xf9da, 2491, 1}, {0xf9db, 2492, 1}, {0xf9dc, 2493, 1},
+    {0xf9dd, 2494, 1}, {0xf9de, 2495, 1}, {0xf9df, 2496, 1}, {0xf9e0, 2497, 1}, {0xf9e1, 2498, 1},
+    {0xf9e2, 2499, 1}, {0xf9e3, 2500, 1}, {0xf9e4, 2501, 1}, {0xf9e5, 2502, 1}, {0xf9e6, 2503, 1},
+    {0xf9e7, 2504, 1}, {0xf9e8, 2505, 1}, {0xf9e9, 2506, 1}, {0xf9ea, 2507, 1}, {0xf9eb, 2508, 1},
+    {0xf9ec, 2509, 1}, {0xf9ed, 2510, 1}, {0xf9ee, 2511, 1}, {0xf9ef, 2512, 1}, {0xf9f0, 2513, 1},
+    {0xf9f1, 2514, 1}, {0xf9f2, 2515, 1}, {0xf9f3, 2516, 1}, {0xf9f4, 2517, 1}, {0xf9f5, 2518, 1},
+    {0xf9f6, 2519, 1}, {0xf9f7, 2520, 1}, {0xf9f8, 2521, 1}, {0xf9f9, 2522, 1}, {0xf9fa, 2523, 1},
+    {0xf9fb, 2524, 1}, {0xf9fc, 2525, 1}, {0xf9fd, 2526, 1}, {0xf9fe, 2527, 1}, {0xf9ff, 2528, 1},
+    {0xfa00, 2529, 1}, {0xfa01, 2530, 1}, {0xfa02, 2531, 1}, {0xfa03, 2532, 1}, {0xfa04, 2533, 1},
+    {0xfa05, 2534, 1}, {0xfa06, 2535, 1}, {0xfa07, 2536, 1}, {0xfa08, 2537, 1}, {0xfa09, 2538, 1},
+    {0xfa0a, 2539, 1}, {0xfa0b, 2540, 1}, {0xfa0c, 2541, 1}, {0xfa0d, 2542, 1}, {0xfa10, 2543, 1},
+    {0xfa12, 2544, 1}, {0xfa15, 2545, 1}, {0xfa16, 2546, 1}, {0xfa17, 2547, 1}, {0xfa18, 2548, 1},
+    {0xfa19, 2549, 1}, {0xfa1a, 2550, 1}, {0xfa1b, 2551, 1}, {0xfa1c, 2552, 1}, {0xfa1d, 2553, 1},
+    {0xfa1e, 2554, 1}, {0xfa20, 2555, 1}, {0xfa22, 2556, 1}, {0xfa25, 2557, 1}, {0xfa26, 2558, 1},
+    {0xfa2a, 2559, 1}, {0xfa2b, 2560, 1}, {0xfa2c, 2561, 1}, {0xfa2d, 2562, 1}, {0xfa2e, 2563, 1},
+    {0xfa2f, 2564, 1}, {0xfa30, 2565, 1}, {0xfa31, 2566, 1}, {0xfa32, 2567, 1}, {0xfa33, 2568, 1},
+    {0xfa34, 2569, 1}, {0xfa35, 2570, 1}, {0xfa36, 2571, 1}, {0xfa37, 2572, 1}, {0xfa38, 2573, 1},
+    {0xfa39, 2574, 1}, {0xfa3a, 2575, 1}, {0xfa3b, 2576, 1}, {0xfa3c, 2577, 1}, {0xfa3d, 2578, 1},
+    {0xfa3e, 2579, 1}, {0xfa3f, 2580, 1}, {0xfa40, 2581, 1}, {0xfa41, 2582, 1}, {0xfa42, 2583, 1},
+    {0xfa43, 2584, 1}, {0xfa44, 2585, 1}, {0xfa45, 2586, 1}, {0xfa46, 2587, 1}, {0xfa47, 2588, 1},
+    {0xfa48, 2589, 1}, {0xfa49, 2590, 1}, {0xfa4a, 2591, 1}, {0xfa4b, 2592, 1}, {0xfa4c, 2593, 1},
+    {0xfa4d, 2594, 1}, {0xfa4e, 2595, 1}, {0xfa4f, 2596, 1}, {0xfa50, 2597, 1}, {0xfa51, 2598, 1},
+    {0xfa52, 2599, 1}, {0xfa53, 2600, 1}, {0xfa54, 2601, 1}, {0xfa55, 2602, 1}, {0xfa56, 2603, 1},
+    {0xfa57, 2604, 1}, {0xfa58, 2605, 1}, {0xfa59, 2606, 1}, {0xfa5a, 2607, 1}, {0xfa5b, 2608, 1},
+    {0xfa5c, 2609, 1}, {0xfa5d, 2610, 1}, {0xfa5e, 2611, 1}, {0xfa5f, 2612, 1}, {0xfa60, 2613, 1},
+    {0xfa61, 2614, 1}, {0xfa62, 2615, 1}, {0xfa63, 2616, 1}, {0xfa64, 2617, 1}, {0xfa65, 2618, 1},
+    {0xfa66, 2619, 1}, {0xfa67, 2620, 1}, {0xfa68, 2621, 1}, {0xfa69, 2622, 1}, {0xfa6a, 2623, 1},
+    {0xfa6b, 2624, 1}, {0xfa6c, 2625, 1}, {0xfa6d, 2626, 1}, {0xfa70, 2627, 1}, {0xfa71, 2628, 1},
+    {0xfa72, 2629, 1}, {0xfa73, 2630, 1}, {0xfa74, 2631, 1}, {0xfa75, 2632, 1}, {0xfa76, 2633, 1},
+    {0xfa77, 2634, 1}, {0xfa78, 2635, 1}, {0xfa79, 2636, 1}, {0xfa7a, 2637, 1}, {0xfa7b, 2638, 1},
+    {0xfa7c, 2639, 1}, {0xfa7d, 2640, 1}, {0xfa7e, 2641, 1}, {0xfa7f, 2642, 1}, {0xfa80, 2643, 1},
+    {0xfa81, 2644, 1}, {0xfa82, 2645, 1}, {0xfa83, 2646, 1}, {0xfa84, 2647, 1}, {0xfa85, 2648, 1},
+    {0xfa86, 2649, 1}, {0xfa87, 2650, 1}, {0xfa88, 2651, 1}, {0xfa89, 2652, 1}, {0xfa8a, 2653, 1},
+    {0xfa8b, 2654, 1}, {0xfa8c, 2655, 1}, {0xfa8d, 2656, 1}, {0xfa8e, 2657, 1}, {0xfa8f, 2658, 1},
+    {0xfa90, 2659, 1}, {0xfa91, 2660, 1}, {0xfa92, 2661, 1}, {0xfa93, 2662, 1}, {0xfa94, 2663, 1},
+    {0xfa95, 2664, 1}, {0xfa96, 2665, 1}, {0xfa97, 2666, 1}, {0xfa98, 2667, 1}, {0xfa99, 2668, 1},
+    {0xfa9a, 2669, 1}, {0xfa9b, 2670, 1}, {0xfa9c, 2671, 1}, {0xfa9d, 2672, 1}, {0xfa9e, 2673, 1},
+    {0xfa9f, 2674, 1}, {0xfaa0, 2675, 1}, {0xfaa1, 2676, 1}, {0xfaa2, 2677, 1}, {0xfaa3, 2678, 1},
+    {0xfaa4, 2679, 1}, {0xfaa5, 2680, 1}, {0xfaa6, 2681, 1}, {0xfaa7, 2682, 1}, {0xfaa8, 2683, 1},
+    {0xfaa9, 2684, 1}, {0xfaaa, 2685, 1}, {0xfaab, 2686, 1}, {0xfaac, 2687, 1}, {0xfaad, 2688, 1},
+    {0xfaae, 2689, 1}, {0xfaaf, 2690, 1}, {0xfab0, 2691, 1}, {0xfab1, 2692, 1}, {0xfab2, 2693, 1},
+    {0xfab3, 2694, 1}, {0xfab4, 2695, 1}, {0xfab5, 2696, 1}, {0xfab6, 2697, 1}, {0xfab7, 2698, 1},
+    {0xfab8, 2699, 1}, {0xfab9, 2700, 1}, {0xfaba, 2701, 1}, {0xfabb, 2702, 1}, {0xfabc, 2703, 1},
+    {0xfabd, 2704, 1}, {0xfabe, 2705, 1}, {0xfabf, 2706, 1}, {0xfac0, 2707, 1}, {0xfac1, 2708, 1},
+    {0xfac2, 2709, 1}, {0xfac3, 2710, 1}, {0xfac4, 2711, 1}, {0xfac5, 2712, 1}, {0xfac6, 2713, 1},
+    {0xfac7, 2714, 1}, {0xfac8, 2715, 1}, {0xfac9, 2716, 1}, {0xfaca, 2717, 1}, {0xfacb, 2718, 1},
+    {0xfacc, 2719, 1}, {0xfacd, 2720, 1}, {0xface, 2721, 1}, {0xfacf, 2722, 1}, {0xfad0, 2723, 1},
+    {0xfad1, 2724, 1}, {0xfad2, 2725, 1}, {0xfad3, 2726, 1}, {0xfad4, 2727, 1}, {0xfad5, 2728, 1},
+    {0xfad6, 2729, 1}, {0xfad7, 2730, 1}, {0xfad8, 2731, 1}, {0xfad9, 2732, 1}, {0xfb1d, 2733, 2},
+    {0xfb1f, 2735, 2}, {0xfb2a, 2737, 2}, {0xfb2b, 2739, 2}, {0xfb2c, 2741, 3}, {0xfb2d, 2744, 3},
+    {0xfb2e, 2747, 2}, {0xfb2f, 2749, 2}, {0xfb30, 2751, 2}, {0xfb31, 2753, 2}, {0xfb32, 2755, 2},
+    {0xfb33, 2757, 2}, {0xfb34, 2759, 2}, {0xfb35, 2761, 2}, {0xfb36, 2763, 2}, {0xfb38, 2765, 2},
+    {0xfb39, 2767, 2}, {0xfb3a, 2769, 2}, {0xfb3b, 2771, 2}, {0xfb3c, 2773, 2}, {0xfb3e, 2775, 2},
+    {0xfb40, 2777, 2}, {0xfb41, 2779, 2}, {0xfb43, 2781, 2}, {0xfb44, 2783, 2}, {0xfb46, 2785, 2},
+    {0xfb47, 2787, 2}, {0xfb48, 2789, 2}, {0xfb49, 2791, 2}, {0xfb4a, 2793, 2}, {0xfb4b, 2795, 2},
+    {0xfb4c, 2797, 2}, {0xfb4d, 2799, 2}, {0xfb4e, 2801, 2}, {0x1109a, 2803, 2}, {0x1109c, 2805, 2},
+    {0x110ab, 2807, 2}, {0x1112e, 2809, 2}, {0x1112f, 2811, 2}, {0x1134b, 2813, 2}, {0x1134c, 2815, 2},
+    {0x114bb, 2817, 2}, {0x114bc, 2819, 2}, {0x114be, 2821, 2}, {0x115ba, 2823, 2}, {0x115bb, 2825, 2},
+    {0x11938, 2827, 2}, {0x1d15e, 2829, 2}, {0x1d15f, 2831, 2}, {0x1d160, 2833, 3}, {0x1d161, 2836, 3},
+    {0x1d162, 2839, 3}, {0x1d163, 2842, 3}, {0x1d164, 2845, 3}, {0x1d1bb, 2848, 2}, {0x1d1bc, 2850, 2},
+    {0x1d1bd, 2852, 3}, {0x1d1be, 2855, 3}, {0x1d1bf, 2858, 3}, {0x1d1c0, 2861, 3}, {0x2f800, 2864, 1},
+    {0x2f801, 2865, 1}, {0x2f802, 2866, 1}, {0x2f803, 2867, 1}, {0x2f804, 2868, 1}, {0x2f805, 2869, 1},
+    {0x2f806, 2870, 1}, {0x2f807, 2871, 1}, {0x2f808, 2872, 1}, {0x2f809, 2873, 1}, {0x2f80a, 2874, 1},
+    {0x2f80b, 2875, 1}, {0x2f80c, 2876, 1}, {0x2f80d, 2877, 1}, {0x2f80e, 2878, 1}, {0x2f80f, 2879, 1},
+    {0x2f810, 2880, 1}, {0x2f811, 2881, 1}, {0x2f812, 2882, 1}, {0x2f813, 2883, 1}, {0x2f814, 2884, 1},
+    {0x2f815, 2885, 1}, {0x2f816, 2886, 1}, {0x2f817, 2887, 1}, {0x2f818, 2888, 1}, {0x2f819, 2889, 1},
+    {0x2f81a, 2890, 1}, {0x2f81b, 2891, 1}, {0x2f81c, 2892, 1}, {0x2f81d, 2893, 1}, {0x2f81e, 2894, 1},
+    {0x2f81f, 2895, 1}, {0x2f820, 2896, 1}, {0x2f821, 2897, 1}, {0x2f822, 2898, 1}, {0x2f823, 2899, 1},
+    {0x2f824, 2900, 1}, {0x2f825, 2901, 1}, {0x2f826, 2902, 1}, {0x2f827, 2903, 1}, {0x2f828, 2904, 1},
+    {0x2f829, 2905, 1}, {0x2f82a, 2906, 1}, {0x2f82b, 2907, 1}, {0x2f82c, 2908, 1}, {0x2f82d, 2909, 1},
+    {0x2f82e, 2910, 1}, {0x2f82f, 2911, 1}, {0x2f830, 2912, 1}, {0x2f831, 2913, 1}, {0x2f832, 2914, 1},
+    {0x2f833, 2915, 1}, {0x2f834, 2916, 1}, {0x2f835, 2917, 1}, {0x2f836, 2918, 1}, {0x2f837, 2919, 1},
+    {0x2f838, 2920, 1}, {0x2f839, 2921, 1}, {0x2f83a, 2922, 1}, {0x2f83b, 2923, 1}, {0x2f83c, 2924, 1},
+    {0x2f83d, 2925, 1}, {0x2f83e, 2926, 1}, {0x2f83f, 2927, 1}, {0x2f840, 2928, 1}, {0x2f841, 2929, 1},
+    {0x2f842, 2930, 1}, {0x2f843, 2931, 1}, {0x2f844, 2932, 1}, {0x2f845, 2933, 1}, {0x2f846, 2934, 1},
+    {0x2f847, 2935, 1}, {0x2f848, 2936, 1}, {0x2f849, 2937, 1}, {0x2f84a, 2938, 1}, {0x2f84b, 2939, 1},
+    {0x2f84c, 2940, 1}, {0x2f84d, 2941, 1}, {0x2f84e, 2942, 1}, {0x2f84f, 2943, 1}, {0x2f850, 2944, 1},
+    {0x2f851, 2945, 1}, {0x2f852, 2946, 1}, {0x2f853, 2947, 1}, {0x2f854, 2948, 1}, {0x2f855, 2949, 1},
+    {0x2f856, 2950, 1}, {0x2f857, 2951, 1}, {0x2f858, 2952, 1}, {0x2f859, 2953, 1}, {0x2f85a, 2954, 1},
+    {0x2f85b, 2955, 1}, {0x2f85c, 2956, 1}, {0x2f85d, 2957, 1}, {0x2f85e, 2958, 1}, {0x2f85f, 2959, 1},
+    {0x2f860, 2960, 1}, {0x2f861, 2961, 1}, {0x2f862, 2962, 1}, {0x2f863, 2963, 1}, {0x2f864, 2964, 1},
+    {0x2f865, 2965, 1}, {0x2f866, 2966, 1}, {0x2f867, 2967, 1}, {0x2f868, 2968, 1}, {0x2f869, 2969, 1},
+    {0x2f86a, 2970, 1}, {0x2f86b, 2971, 1}, {0x2f86c, 2972, 1}, {0x2f86d, 2973, 1}, {0x2f86e, 2974, 1},
+    {0x2f86f, 2975, 1}, {0x2f870, 2976, 1}, {0x2f871, 2977, 1}, {0x2f872, 2978, 1}, {0x2f873, 2979, 1},
+    {0x2f874, 2980, 1}, {0x2f875, 2981, 1}, {0x2f876, 2982, 1}, {0x2f877, 2983, 1}, {0x2f878, 2984, 1},
+    {0x2f879, 2985, 1}, {0x2f87a, 2986, 1}, {0x2f87b, 2987, 1}, {0x2f87c, 2988, 1}, {0x2f87d, 2989, 1},
+    {0x2f87e, 2990, 1}, {0x2f87f, 2991, 1}, {0x2f880, 2992, 1}, {0x2f881, 2993, 1}, {0x2f882, 2994, 1},
+    {0x2f883, 2995, 1}, {0x2f884, 2996, 1}, {0x2f885, 2997, 1}, {0x2f886, 2998, 1}, {0x2f887, 2999, 1},
+    {0x2f888, 3000, 1}, {0x2f889, 3001, 1}, {0x2f88a, 3002, 1}, {0x2f88b, 3003, 1}, {0x2f88c, 3004, 1},
+    {0x2f88d, 3005, 1}, {0x2f88e, 3006, 1}, {0x2f88f, 3007, 1}, {0x2f890, 3008, 1}, {0x2f891, 3009, 1},
+    {0x2f892, 3010, 1}, {0x2f893, 3011, 1}, {0x2f894, 3012, 1}, {0x2f895, 3013, 1}, {0x2f896, 3014, 1},
+    {0x2f897, 3015, 1}, {0x2f898, 3016, 1}, {0x2f899, 3017, 1}, {0x2f89a, 3018, 1}, {0x2f89b, 3019, 1},
+    {0x2f89c, 3020, 1}, {0x2f89d, 3021, 1}, {0x2f89e, 3022, 1}, {0x2f89f, 3023, 1}, {0x2f8a0, 3024, 1},
+    {0x2f8a1, 3025, 1}, {0x2f8a2, 3026, 1}, {0x2f8a3, 3027, 1}, {0x2f8a4, 3028, 1}, {0x2f8a5, 3029, 1},
+    {0x2f8a6, 3030, 1}, {0x2f8a7, 3031, 1}, {0x2f8a8, 3032, 1}, {0x2f8a9, 3033, 1}, {0x2f8aa, 3034, 1},
+    {0x2f8ab, 3035, 1}, {0x2f8ac, 3036, 1}, {0x2f8ad, 3037, 1}, {0x2f8ae, 3038, 1}, {0x2f8af, 3039, 1},
+    {0x2f8b0, 3040, 1}, {0x2f8b1, 3041, 1}, {0x2f8b2, 3042, 1}, {0x2f8b3, 3043, 1}, {0x2f8b4, 3044, 1},
+    {0x2f8b5, 3045, 1}, {0x2f8b6, 3046, 1}, {0x2f8b7, 3047, 1}, {0x2f8b8, 3048, 1}, {0x2f8b9, 3049, 1},
+    {0x2f8ba, 3050, 1}, {0x2f8bb, 3051, 1}, {0x2f8bc, 3052, 1}, {0x2f8bd, 3053, 1}, {0x2f8be, 3054, 1},
+    {0x2f8bf, 3055, 1}, {0x2f8c0, 3056, 1}, {0x2f8c1, 3057, 1}, {0x2f8c2, 3058, 1}, {0x2f8c3, 3059, 1},
+    {0x2f8c4, 3060, 1}, {0x2f8c5, 3061, 1}, {0x2f8c6, 3062, 1}, {0x2f8c7, 3063, 1}, {0x2f8c8, 3064, 1},
+    {0x2f8c9, 3065, 1}, {0x2f8ca, 3066, 1}, {0x2f8cb, 3067, 1}, {0x2f8cc, 3068, 1}, {0x2f8cd, 3069, 1},
+    {0x2f8ce, 3070, 1}, {0x2f8cf, 3071, 1}, {0x2f8d0, 3072, 1}, {0x2f8d1, 3073, 1}, {0x2f8d2, 3074, 1},
+    {0x2f8d3, 3075, 1}, {0x2f8d4, 3076, 1}, {0x2f8d5, 3077, 1}, {0x2f8d6, 3078, 1}, {0x2f8d7, 3079, 1},
+    {0x2f8d8, 3080, 1}, {0x2f8d9, 3081, 1}, {0x2f8da, 3082, 1}, {0x2f8db, 3083, 1}, {0x2f8dc, 3084, 1},
+    {0x2f8dd, 3085, 1}, {0x2f8de, 3086, 1}, {0x2f8df, 3087, 1}, {0x2f8e0, 3088, 1}, {0x2f8e1, 3089, 1},
+    {0x2f8e2, 3090, 1}, {0x2f8e3, 3091, 1}, {0x2f8e4, 3092, 1}, {0x2f8e5, 3093, 1}, {0x2f8e6, 3094, 1},
+    {0x2f8e7, 3095, 1}, {0x2f8e8, 3096, 1}, {0x2f8e9, 3097, 1}, {0x2f8ea, 3098, 1}, {0x2f8eb, 3099, 1},
+    {0x2f8ec, 3100, 1}, {0x2f8ed, 3101, 1}, {0x2f8ee, 3102, 1}, {0x2f8ef, 3103, 1}, {0x2f8f0, 3104, 1},
+    {0x2f8f1, 3105, 1}, {0x2f8f2, 3106, 1}, {0x2f8f3, 3107, 1}, {0x2f8f4, 3108, 1}, {0x2f8f5, 3109, 1},
+    {0x2f8f6, 3110, 1}, {0x2f8f7, 3111, 1}, {0x2f8f8, 3112, 1}, {0x2f8f9, 3113, 1}, {0x2f8fa, 3114, 1},
+    {0x2f8fb, 3115, 1}, {0x2f8fc, 3116, 1}, {0x2f8fd, 3117, 1}, {0x2f8fe, 3118, 1}, {0x2f8ff, 3119, 1},
+    {0x2f900, 3120, 1}, {0x2f901, 3121, 1}, {0x2f902, 3122, 1}, {0x2f903, 3123, 1}, {0x2f904, 3124, 1},
+    {0x2f905, 3125, 1}, {0x2f906, 3126, 1}, {0x2f907, 3127, 1}, {0x2f908, 3128, 1}, {0x2f909, 3129, 1},
+    {0x2f90a, 3130, 1}, {0x2f90b, 3131, 1}, {0x2f90c, 3132, 1}, {0x2f90d, 3133, 1}, {0x2f90e, 3134, 1},
+    {0x2f90f, 3135, 1}, {0x2f910, 3136, 1}, {0x2f911, 3137, 1}, {0x2f912, 3138, 1}, {0x2f913, 3139, 1},
+    {0x2f914, 3140, 1}, {0x2f915, 3141, 1}, {0x2f916, 3142, 1}, {0x2f917, 3143, 1}, {0x2f918, 3144, 1},
+    {0x2f919, 3145, 1}, {0x2f91a, 3146, 1}, {0x2f91b, 3147, 1}, {0x2f91c, 3148, 1}, {0x2f91d, 3149, 1},
+    {0x2f91e, 3150, 1}, {0x2f91f, 3151, 1}, {0x2f920, 3152, 1}, {0x2f921, 3153, 1}, {0x2f922, 3154, 1},
+    {0x2f923, 3155, 1}, {0x2f924, 3156, 1}, {0x2f925, 3157, 1}, {0x2f926, 3158, 1}, {0x2f927, 3159, 1},
+    {0x2f928, 3160, 1}, {0x2f929, 3161, 1}, {0x2f92a, 3162, 1}, {0x2f92b, 3163, 1}, {0x2f92c, 3164, 1},
+    {0x2f92d, 3165, 1}, {0x2f92e, 3166, 1}, {0x2f92f, 3167, 1}, {0x2f930, 3168, 1}, {0x2f931, 3169, 1},
+    {0x2f932, 3170, 1}, {0x2f933, 3171, 1}, {0x2f934, 3172, 1}, {0x2f935, 3173, 1}, {0x2f936, 3174, 1},
+    {0x2f937, 3175, 1}, {0x2f938, 3176, 1}, {0x2f939, 3177, 1}, {0x2f93a, 3178, 1}, {0x2f93b, 3179, 1},
+    {0x2f93c, 3180, 1}, {0x2f93d, 3181, 1}, {0x2f93e, 3182, 1}, {0x2f93f, 3183, 1}, {0x2f940, 3184, 1},
+    {0x2f941, 3185, 1}, {0x2f942, 3186, 1}, {0x2f943, 3187, 1}, {0x2f944, 3188, 1}, {0x2f945, 3189, 1},
+    {0x2f946, 3190, 1}, {0x2f947, 3191, 1}, {0x2f948, 3192, 1}, {0x2f949, 3193, 1}, {0x2f94a, 3194, 1},
+    {0x2f94b, 3195, 1}, {0x2f94c, 3196, 1}, {0x2f94d, 3197, 1}, {0x2f94e, 3198, 1}, {0x2f94f, 3199, 1},
+    {0x2f950, 3200, 1}, {0x2f951, 3201, 1}, {0x2f952, 3202, 1}, {0x2f953, 3203, 1}, {0x2f954, 3204, 1},
+    {0x2f955, 3205, 1}, {0x2f956, 3206, 1}, {0x2f957, 3207, 1}, {0x2f958, 3208, 1}, {0x2f959, 3209, 1},
+    {0x2f95a, 3210, 1}, {0x2f95b, 3211, 1}, {0x2f95c, 3212, 1}, {0x2f95d, 3213, 1}, {0x2f95e, 3214, 1},
+    {0x2f95f, 3215, 1}, {0x2f960, 3216, 1}, {0x2f961, 3217, 1}, {0x2f962, 3218, 1}, {0x2f963, 3219, 1},
+    {0x2f964, 3220, 1}, {0x2f965, 3221, 1}, {0x2f966, 3222, 1}, {0x2f967, 3223, 1}, {0x2f968, 3224, 1},
+    {0x2f969, 3225, 1}, {0x2f96a, 3226, 1}, {0x2f96b, 3227, 1}, {0x2f96c, 3228, 1}, {0x2f96d, 3229, 1},
+    {0x2f96e, 3230, 1}, {0x2f96f, 3231, 1}, {0x2f970, 3232, 1}, {0x2f971, 3233, 1}, {0x2f972, 3234, 1},
+    {0x2f973, 3235, 1}, {0x2f974, 3236, 1}, {0x2f975, 3237, 1}, {0x2f976, 3238, 1}, {0x2f977, 3239, 1},
+    {0x2f978, 3240, 1}, {0x2f979, 3241, 1}, {0x2f97a, 3242, 1}, {0x2f97b, 3243, 1}, {0x2f97c, 3244, 1},
+    {0x2f97d, 3245, 1}, {0x2f97e, 3246, 1}, {0x2f97f, 3247, 1}, {0x2f980, 3248, 1}, {0x2f981, 3249, 1},
+    {0x2f982, 3250, 1}, {0x2f983, 3251, 1}, {0x2f984, 3252, 1}, {0x2f985, 3253, 1}, {0x2f986, 3254, 1},
+    {0x2f987, 3255, 1}, {0x2f988, 3256, 1}, {0x2f989, 3257, 1}, {0x2f98a, 3258, 1}, {0x2f98b, 3259, 1},
+    {0x2f98c, 3260, 1}, {0x2f98d, 3261, 1}, {0x2f98e, 3262, 1}, {0x2f98f, 3263, 1}, {0x2f990, 3264, 1},
+    {0x2f991, 3265, 1}, {0x2f992, 3266, 1}, {0x2f993, 3267, 1}, {0x2f994, 3268, 1}, {0x2f995, 3269, 1},
+    {0x2f996, 3270, 1}, {0x2f997, 3271, 1}, {0x2f998, 3272, 1}, {0x2f999, 3273, 1}, {0x2f99a, 3274, 1},
+    {0x2f99b, 3275, 1}, {0x2f99c, 3276, 1}, {0x2f99d, 3277, 1}, {0x2f99e, 3278, 1}, {0x2f99f, 3279, 1},
+    {0x2f9a0, 3280, 1}, {0x2f9a1, 3281, 1}, {0x2f9a2, 3282, 1}, {0x2f9a3, 3283, 1}, {0x2f9a4, 3284, 1},
+    {0x2f9a5, 3285, 1}, {0x2f9a6, 3286, 1}, {0x2f9a7, 3287, 1}, {0x2f9a8, 3288, 1}, {0x2f9a9, 3289, 1},
+    {0x2f9aa, 3290, 1}, {0x2f9ab, 3291, 1}, {0x2f9ac, 3292, 1}, {0x2f9ad, 3293, 1}, {0x2f9ae, 3294, 1},
+    {0x2f9af, 3295, 1}, {0x2f9b0, 3296, 1}, {0x2f9b1, 3297, 1}, {0x2f9b2, 3298, 1}, {0x2f9b3, 3299, 1},
+    {0x2f9b4, 3300, 1}, {0x2f9b5, 3301, 1}, {0x2f9b6, 3302, 1}, {0x2f9b7, 3303, 1}, {0x2f9b8, 3304, 1},
+    {0x2f9b9, 3305, 1}, {0x2f9ba, 3306, 1}, {0x2f9bb, 3307, 1}, {0x2f9bc, 3308, 1}, {0x2f9bd, 3309, 1},
+    {0x2f9be, 3310, 1}, {0x2f9bf, 3311, 1}, {0x2f9c0, 3312, 1}, {0x2f9c1, 3313, 1}, {0x2f9c2, 3314, 1},
+    {0x2f9c3, 3315, 1}, {0x2f9c4, 3316, 1}, {0x2f9c5, 3317, 1}, {0x2f9c6, 3318, 1}, {0x2f9c7, 3319, 1},
+    {0x2f9c8, 3320, 1}, {0x2f9c9, 3321, 1}, {0x2f9ca, 3322, 1}, {0x2f9cb, 3323, 1}, {0x2f9cc, 3324, 1},
+    {0x2f9cd, 3325, 1}, {0x2f9ce, 3326, 1}, {0x2f9cf, 3327, 1}, {0x2f9d0, 3328, 1}, {0x2f9d1, 3329, 1},
+    {0x2f9d2, 3330, 1}, {0x2f9d3, 3331, 1}, {0x2f9d4, 3332, 1}, {0x2f9d5, 3333, 1}, {0x2f9d6, 3334, 1},
+    {0x2f9d7, 3335, 1}, {0x2f9d8, 3336, 1}, {0x2f9d9, 3337, 1}, {0x2f9da, 3338, 1}, {0x2f9db, 3339, 1},
+    {0x2f9dc, 3340, 1}, {0x2f9dd, 3341, 1}, {0x2f9de, 3342, 1}, {0x2f9df, 3343, 1}, {0x2f9e0, 3344, 1},
+    {0x2f9e1, 3345, 1}, {0x2f9e2, 3346, 1}, {0x2f9e3, 3347, 1}, {0x2f9e4, 3348, 1}, {0x2f9e5, 3349, 1},
+    {0x2f9e6, 3350, 1}, {0x2f9e7, 3351, 1}, {0x2f9e8, 3352, 1}, {0x2f9e9, 3353, 1}, {0x2f9ea, 3354, 1},
+    {0x2f9eb, 3355, 1}, {0x2f9ec, 3356, 1}, {0x2f9ed, 3357, 1}, {0x2f9ee, 3358, 1}, {0x2f9ef, 3359, 1},
+    {0x2f9f0, 3360, 1}, {0x2f9f1, 3361, 1}, {0x2f9f2, 3362, 1}, {0x2f9f3, 3363, 1}, {0x2f9f4, 3364, 1},
+    {0x2f9f5, 3365, 1}, {0x2f9f6, 3366, 1}, {0x2f9f7, 3367, 1}, {0x2f9f8, 3368, 1}, {0x2f9f9, 3369, 1},
+    {0x2f9fa, 3370, 1}, {0x2f9fb, 3371, 1}, {0x2f9fc, 3372, 1}, {0x2f9fd, 3373, 1}, {0x2f9fe, 3374, 1},
+    {0x2f9ff, 3375, 1}, {0x2fa00, 3376, 1}, {0x2fa01, 3377, 1}, {0x2fa02, 3378, 1}, {0x2fa03, 3379, 1},
+    {0x2fa04, 3380, 1}, {0x2fa05, 3381, 1}, {0x2fa06, 3382, 1}, {0x2fa07, 3383, 1}, {0x2fa08, 3384, 1},
+    {0x2fa09, 3385, 1}, {0x2fa0a, 3386, 1}, {0x2fa0b, 3387, 1}, {0x2fa0c, 3388, 1}, {0x2fa0d, 3389, 1},
+    {0x2fa0e, 3390, 1}, {0x2fa0f, 3391, 1}, {0x2fa10, 3392, 1}, {0x2fa11, 3393, 1}, {0x2fa12, 3394, 1},
+    {0x2fa13, 3395, 1}, {0x2fa14, 3396, 1}, {0x2fa15, 3397, 1}, {0x2fa16, 3398, 1}, {0x2fa17, 3399, 1},
+    {0x2fa18, 3400, 1}, {0x2fa19, 3401, 1}, {0x2fa1a, 3402, 1}, {0x2fa1b, 3403, 1}, {0x2fa1c, 3404, 1},
+    {0x2fa1d, 3405, 1},
+}};
+
+constexpr std::array<char32_t, 3406> decomposition_data{
+    0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303, 0x0041, 0x0308,
+    0x0041, 0x030a, 0x0043, 0x0327, 0x0045, 0x0300, 0x0045, 0x0301, 0x0045, 0x0302,
+    0x0045, 0x0308, 0x0049, 0x0300, 0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308,
+    0x004e, 0x0303, 0x004f, 0x0300, 0x004f, 0x0301, 0x004f, 0x0302, 0x004f, 0x0303,
+    0x004f, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302, 0x0055, 0x0308,
+    0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301, 0x0061, 0x0302, 0x0061, 0x0303,
+    0x0061, 0x0308, 0x0061, 0x030a, 0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301,
+    0x0065, 0x0302, 0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+    0x0069, 0x0308, 0x006e, 0x0303, 0x006f, 0x0300, 0x006f, 0x0301, 0x006f, 0x0302,
+    0x006f, 0x0303, 0x006f, 0x0308, 0x0075, 0x0300, 0x0075, 0x0301, 0x0075, 0x0302,
+    0x0075, 0x0308, 0x0079, 0x0301, 0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304,
+    0x0041, 0x0306, 0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+    0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307, 0x0063, 0x0307,
+    0x0043, 0x030c, 0x0063, 0x030c, 0x0044, 0x030c, 0x0064, 0x030c, 0x0045, 0x0304,
+    0x0065, 0x0304, 0x0045, 0x0306, 0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307,
+    0x0045, 0x0328, 0x0065, 0x0328, 0x0045, 0x030c, 0x0065, 0x030c, 0x0047, 0x0302,
+    0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307, 0x0067, 0x0307,
+    0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302, 0x0068, 0x0302, 0x0049, 0x0303,
+    0x0069, 0x0303, 0x0049, 0x0304, 0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306,
+    0x0049, 0x0328, 0x0069, 0x0328, 0x0049, 0x0307, 0x004a, 0x0302, 0x006a, 0x0302,
+    0x004b, 0x0327, 0x006b, 0x0327, 0x004c, 0x0301, 0x006c, 0x0301, 0x004c, 0x0327,
+    0x006c, 0x0327, 0x004c, 0x030c, 0x006c, 0x030c, 0x004e, 0x0301, 0x006e, 0x0301,
+    0x004e, 0x0327, 0x006e, 0x0327, 0x004e, 0x030c, 0x006e, 0x030c, 0x004f, 0x0304,
+    0x006f, 0x0304, 0x004f, 0x0306, 0x006f, 0x0306, 0x004f, 0x030b, 0x006f, 0x030b,
+    0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327, 0x0052, 0x030c,
+    0x0072, 0x030c, 0x0053, 0x0301, 0x0073, 0x0301, 0x0053, 0x0302, 0x0073, 0x0302,
+    0x0053, 0x0327, 0x0073, 0x0327, 0x0053, 0x030c, 0x0073, 0x030c, 0x0054, 0x0327,
+    0x0074, 0x0327, 0x0054, 0x030c, 0x0074, 0x030c, 0x0055, 0x0303, 0x0075, 0x0303,
+    0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306, 0x0055, 0x030a,
+    0x0075, 0x030a, 0x0055, 0x030b, 0x0075, 0x030b, 0x0055, 0x0328, 0x0075, 0x0328,
+    0x0057, 0x0302, 0x0077, 0x0302, 0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308,
+    0x005a, 0x0301, 0x007a, 0x0301, 0x005a, 0x0307, 0x007a, 0x0307, 0x005a, 0x030c,
+    0x007a, 0x030c, 0x004f, 0x031b, 0x006f, 0x031b, 0x0055, 0x031b, 0x0075, 0x031b,
+    0x0041, 0x030c, 0x0061, 0x030c, 0x0049, 0x030c, 0x0069, 0x030c, 0x004f, 0x030c,
+    0x006f, 0x030c, 0x0055, 0x030c, 0x0075, 0x030c, 0x0055, 0x0308, 0x0304, 0x0075,
+    0x0308, 0x0304, 0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+    0x030c, 0x0075, 0x0308, 0x030c, 0x0055, 0x0308, 0x0300, 0x0075, 0x0308, 0x0300,
+    0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304, 0x0041, 0x0307, 0x0304, 0x0061,
+    0x0307, 0x0304, 0x00c6, 0x0304, 0x00e6, 0x0304, 0x0047, 0x030c, 0x0067, 0x030c,
+    0x004b, 0x030c, 0x006b, 0x030c, 0x004f, 0x0328, 0x006f, 0x0328, 0x004f, 0x0328,
+    0x0304, 0x006f, 0x0328, 0x0304, 0x01b7, 0x030c, 0x0292, 0x030c, 0x006a, 0x030c,
+    0x0047, 0x0301, 0x0067, 0x0301, 0x004e, 0x0300, 0x006e, 0x0300, 0x0041, 0x030a,
+    0x0301, 0x0061, 0x030a, 0x0301, 0x00c6, 0x0301, 0x00e6, 0x0301, 0x00d8, 0x0301,
+    0x00f8, 0x0301, 0x0041, 0x030f, 0x0061, 0x030f, 0x0041, 0x0311, 0x0061, 0x0311,
+    0x0045, 0x030f, 0x0065, 0x030f, 0x0045, 0x0311, 0x0065, 0x0311, 0x0049, 0x030f,
+    0x0069, 0x030f, 0x0049, 0x0311, 0x0069, 0x0311, 0x004f, 0x030f, 0x006f, 0x030f,
+    0x004f, 0x0311, 0x006f, 0x0311, 0x0052, 0x030f, 0x0072, 0x030f, 0x0052, 0x0311,
+    0x0072, 0x0311, 0x0055, 0x030f, 0x0075, 0x030f, 0x0055, 0x0311, 0x0075, 0x0311,
+    0x0053, 0x0326, 0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326, 0x0048, 0x030c,
+    0x0068, 0x030c, 0x0041, 0x0307, 0x0061, 0x0307, 0x0045, 0x0327, 0x0065, 0x0327,
+    0x004f, 0x0308, 0x0304, 0x006f, 0x0308, 0x0304, 0x004f, 0x0303, 0x0304, 0x006f,
+    0x0303, 0x0304, 0x004f, 0x0307, 0x006f, 0x0307, 0x004f, 0x0307, 0x0304, 0x006f,
+    0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0300, 0x0301, 0x0313, 0x0308,
+    0x0301, 0x02b9, 0x003b, 0x00a8, 0x0301, 0x0391, 0x0301, 0x00b7, 0x0395, 0x0301,
+    0x0397, 0x0301, 0x0399, 0x0301, 0x039f, 0x0301, 0x03a5, 0x0301, 0x03a9, 0x0301,
+    0x03b9, 0x0308, 0x0301, 0x0399, 0x0308, 0x03a5, 0x0308, 0x03b1, 0x0301, 0x03b5,
+    0x0301, 0x03b7, 0x0301, 0x03b9, 0x0301, 0x03c5, 0x0308, 0x0301, 0x03b9, 0x0308,
+    0x03c5, 0x0308, 0x03bf, 0x0301, 0x03c5, 0x0301, 0x03c9, 0x0301, 0x03d2, 0x0301,
+    0x03d2, 0x0308, 0x0415, 0x0300, 0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308,
+    0x041a, 0x0301, 0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306,
+    0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308, 0x043a, 0x0301,
+    0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030f, 0x0475, 0x030f, 0x0416, 0x0306,
+    0x0436, 0x0306, 0x0410, 0x0306, 0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308,
+    0x0415, 0x0306, 0x0435, 0x0306, 0x04d8, 0x0308, 0x04d9, 0x0308, 0x0416, 0x0308,
+    0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304, 0x0438, 0x0304,
+    0x0418, 0x0308, 0x0438, 0x0308, 0x041e, 0x0308, 0x043e, 0x0308, 0x04e8, 0x0308,
+    0x04e9, 0x0308, 0x042d, 0x0308, 0x044d, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304,
+    0x0423, 0x0308, 0x0443, 0x0308, 0x0423, 0x030b, 0x0443, 0x030b, 0x0427, 0x0308,
+    0x0447, 0x0308, 0x042b, 0x0308, 0x044b, 0x0308, 0x0627, 0x0653, 0x0627, 0x0654,
+    0x0648, 0x0654, 0x0627, 0x0655, 0x064a, 0x0654, 0x06d5, 0x0654, 0x06c1, 0x0654,
+    0x06d2, 0x0654, 0x0928, 0x093c, 0x0930, 0x093c, 0x0933, 0x093c, 0x0915, 0x093c,
+    0x0916, 0x093c, 0x0917, 0x093c, 0x091c, 0x093c, 0x0921, 0x093c, 0x0922, 0x093c,
+    0x092b, 0x093c, 0x092f, 0x093c, 0x09c7, 0x09be, 0x09c7, 0x09d7, 0x09a1, 0x09bc,
+    0x09a2, 0x09bc, 0x09af, 0x09bc, 0x0a32, 0x0a3c, 0x0a38, 0x0a3c, 0x0a16, 0x0a3c,
+    0x0a17, 0x0a3c, 0x0a1c, 0x0a3c, 0x0a2b, 0x0a3c, 0x0b47, 0x0b56, 0x0b47, 0x0b3e,
+    0x0b47, 0x0b57, 0x0b21, 0x0b3c, 0x0b22, 0x0b3c, 0x0b92, 0x0bd7, 0x0bc6, 0x0bbe,
+    0x0bc7, 0x0bbe, 0x0bc6, 0x0bd7, 0x0c46, 0x0c56, 0x0cbf, 0x0cd5, 0x0cc6, 0x0cd5,
+    0x0cc6, 0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2, 0x0cd5, 0x0d46, 0x0d3e, 0x0d47,
+    0x0d3e, 0x0d46, 0x0d57, 0x0dd9, 0x0dca, 0x0dd9, 0x0dcf, 0x0dd9, 0x0dcf, 0x0dca,
+    0x0dd9, 0x0ddf, 0x0f42, 0x0fb7, 0x0f4c, 0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7,
+    0x0f5b, 0x0fb7, 0x0f40, 0x0fb5, 0x0f71, 0x0f72, 0x0f71, 0x0f74, 0x0fb2, 0x0f80,
+    0x0fb3, 0x0f80, 0x0f71, 0x0f80, 0x0f92, 0x0fb7, 0x0f9c, 0x0fb7, 0x0fa1, 0x0fb7,
+    0x0fa6, 0x0fb7, 0x0fab, 0x0fb7, 0x0f90, 0x0fb5, 0x1025, 0x102e, 0x1b05, 0x1b35,
+    0x1b07, 0x1b35, 0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35,
+    0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35, 0x1b42, 0x1b35,
+    0x0041, 0x0325, 0x0061, 0x0325, 0x0042, 0x0307, 0x0062, 0x0307, 0x0042, 0x0323,
+    0x0062, 0x0323, 0x0042, 0x0331, 0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063,
+    0x0327, 0x0301, 0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323, 0x0064, 0x0323,
+    0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327, 0x0044, 0x032d,
+    0x0064, 0x032d, 0x0045, 0x0304, 0x0300, 0x0065, 0x0304, 0x0300, 0x0045, 0x0304,
+    0x0301, 0x0065, 0x0304, 0x0301, 0x0045, 0x032d, 0x0065, 0x032d, 0x0045, 0x0330,
+    0x0065, 0x0330, 0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307,
+    0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304, 0x0048, 0x0307, 0x0068, 0x0307,
+    0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308, 0x0068, 0x0308, 0x0048, 0x0327,
+    0x0068, 0x0327, 0x0048, 0x032e, 0x0068, 0x032e, 0x0049, 0x0330, 0x0069, 0x0330,
+    0x0049, 0x0308, 0x0301, 0x0069, 0x0308, 0x0301, 0x004b, 0x0301, 0x006b, 0x0301,
+    0x004b, 0x0323, 0x006b, 0x0323, 0x004b, 0x0331, 0x006b, 0x0331, 0x004c, 0x0323,
+    0x006c, 0x0323, 0x004c, 0x0323, 0x0304, 0x006c, 0x0323, 0x0304, 0x004c, 0x0331,
+    0x006c, 0x0331, 0x004c, 0x032d, 0x006c, 0x032d, 0x004d, 0x0301, 0x006d, 0x0301,
+    0x004d, 0x0307, 0x006d, 0x0307, 0x004d, 0x0323, 0x006d, 0x0323, 0x004e, 0x0307,
+    0x006e, 0x0307, 0x004e, 0x0323, 0x006e, 0x0323, 0x004e, 0x0331, 0x006e, 0x0331,
+    0x004e, 0x032d, 0x006e, 0x032d, 0x004f, 0x0303, 0x0301, 0x006f, 0x0303, 0x0301,
+    0x004f, 0x0303, 0x0308, 0x006f, 0x0303, 0x0308, 0x004f, 0x0304, 0x0300, 0x006f,
+    0x0304, 0x0300, 0x004f, 0x0304, 0x0301, 0x006f, 0x0304, 0x0301, 0x0050, 0x0301,
+    0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307, 0x0052, 0x0307, 0x0072, 0x0307,
+    0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323, 0x0304, 0x0072, 0x0323, 0x0304,
+    0x0052, 0x0331, 0x0072, 0x0331, 0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323,
+    0x0073, 0x0323, 0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030c,
+    0x0307, 0x0073, 0x030c, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073, 0x0323, 0x0307,
+    0x0054, 0x0307, 0x0074, 0x0307, 0x0054, 0x0323, 0x0074, 0x0323, 0x0054, 0x0331,
+    0x0074, 0x0331, 0x0054, 0x032d, 0x0074, 0x032d, 0x0055, 0x0324, 0x0075, 0x0324,
+    0x0055, 0x0330, 0x0075, 0x0330, 0x0055, 0x032d, 0x0075, 0x032d, 0x0055, 0x0303,
+    0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075, 0x0304, 0x0308,
+    0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323, 0x0076, 0x0323, 0x0057, 0x0300,
+    0x0077, 0x0300, 0x0057, 0x0301, 0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308,
+    0x0057, 0x0307, 0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307,
+    0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308, 0x0059, 0x0307, 0x0079, 0x0307,
+    0x005a, 0x0302, 0x007a, 0x0302, 0x005a, 0x0323, 0x007a, 0x0323, 0x005a, 0x0331,
+    0x007a, 0x0331, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030a, 0x0079, 0x030a,
+    0x017f, 0x0307, 0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309,
+    0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302, 0x0300, 0x0061,
+    0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061, 0x0302, 0x0309, 0x0041, 0x0302,
+    0x0303, 0x0061, 0x0302, 0x0303, 0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302,
+    0x0041, 0x0306, 0x0301, 0x0061, 0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061,
+    0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309, 0x0041, 0x0306,
+    0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323, 0x0306, 0x0061, 0x0323, 0x0306,
+    0x0045, 0x0323, 0x0065, 0x0323, 0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303,
+    0x0065, 0x0303, 0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302,
+    0x0300, 0x0065, 0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065, 0x0302, 0x0309,
+    0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303, 0x0045, 0x0323, 0x0302, 0x0065,
+    0x0323, 0x0302, 0x0049, 0x0309, 0x0069, 0x0309, 0x0049, 0x0323, 0x0069, 0x0323,
+    0x004f, 0x0323, 0x006f, 0x0323, 0x004f, 0x0309, 0x006f, 0x0309, 0x004f, 0x0302,
+    0x0301, 0x006f, 0x0302, 0x0301, 0x004f, 0x0302, 0x0300, 0x006f, 0x0302, 0x0300,
+    0x004f, 0x0302, 0x0309, 0x006f, 0x0302, 0x0309, 0x004f, 0x0302, 0x0303, 0x006f,
+    0x0302, 0x0303, 0x004f, 0x0323, 0x0302, 0x006f, 0x0323, 0x0302, 0x004f, 0x031b,
+    0x0301, 0x006f, 0x031b, 0x0301, 0x004f, 0x031b, 0x0300, 0x006f, 0x031b, 0x0300,
+    0x004f, 0x031b, 0x0309, 0x006f, 0x031b, 0x0309, 0x004f, 0x031b, 0x0303, 0x006f,
+    0x031b, 0x0303, 0x004f, 0x031b, 0x0323, 0x006f, 0x031b, 0x0323, 0x0055, 0x0323,
+    0x0075, 0x0323, 0x0055, 0x0309, 0x0075, 0x0309, 0x0055, 0x031b, 0x0301, 0x0075,
+    0x031b, 0x0301, 0x0055, 0x031b, 0x0300, 0x0075, 0x031b, 0x0300, 0x0055, 0x031b,
+    0x0309, 0x0075, 0x031b, 0x0309, 0x0055, 0x031b, 0x0303, 0x0075, 0x031b, 0x0303,
+    0x0055, 0x031b, 0x0323, 0x0075, 0x031b, 0x0323, 0x0059, 0x0300, 0x0079, 0x0300,
+    0x0059, 0x0323, 0x0079, 0x0323, 0x0059, 0x0309, 0x0079, 0x0309, 0x0059, 0x0303,
+    0x0079, 0x0303, 0x03b1, 0x0313, 0x03b1, 0x0314, 0x03b1, 0x0313, 0x0300, 0x03b1,
+    0x0314, 0x0300, 0x03b1, 0x0313, 0x0301, 0x03b1, 0x0314, 0x0301, 0x03b1, 0x0313,
+    0x0342, 0x03b1, 0x0314, 0x0342, 0x0391, 0x0313, 0x0391, 0x0314, 0x0391, 0x0313,
+    0x0300, 0x0391, 0x0314, 0x0300, 0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301,
+    0x0391, 0x0313, 0x0342, 0x0391, 0x0314, 0x0342, 0x03b5, 0x0313, 0x03b5, 0x0314,
+    0x03b5, 0x0313, 0x0300, 0x03b5, 0x0314, 0x0300, 0x03b5, 0x0313, 0x0301, 0x03b5,
+    0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314, 0x0395, 0x0313, 0x0300, 0x0395,
+    0x0314, 0x0300, 0x0395, 0x0313, 0x0301, 0x0395, 0x0314, 0x0301, 0x03b7, 0x0313,
+    0x03b7, 0x0314, 0x03b7, 0x0313, 0x0300, 0x03b7, 0x0314, 0x0300, 0x03b7, 0x0313,
+    0x0301, 0x03b7, 0x0314, 0x0301, 0x03b7, 0x0313, 0x0342, 0x03b7, 0x0314, 0x0342,
+    0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313, 0x0300, 0x0397, 0x0314, 0x0300,
+    0x0397, 0x0313, 0x0301, 0x0397, 0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397,
+    0x0314, 0x0342, 0x03b9, 0x0313, 0x03b9, 0x0314, 0x03b9, 0x0313, 0x0300, 0x03b9,
+    0x0314, 0x0300, 0x03b9, 0x0313, 0x0301, 0x03b9, 0x0314, 0x0301, 0x03b9, 0x0313,
+    0x0342, 0x03b9, 0x0314, 0x0342, 0x0399, 0x0313, 0x0399, 0x0314, 0x0399, 0x0313,
+    0x0300, 0x0399, 0x0314, 0x0300, 0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301,
+    0x0399, 0x0313, 0x0342, 0x0399, 0x0314, 0x0342, 0x03bf, 0x0313, 0x03bf, 0x0314,
+    0x03bf, 0x0313, 0x0300, 0x03bf, 0x0314, 0x0300, 0x03bf, 0x0313, 0x0301, 0x03bf,
+    0x0314, 0x0301, 0x039f, 0x0313, 0x039f, 0x0314, 0x039f, 0x0313, 0x0300, 0x039f,
+    0x0314, 0x0300, 0x039f, 0x0313, 0x0301, 0x039f, 0x0314, 0x0301, 0x03c5, 0x0313,
+    0x03c5, 0x0314, 0x03c5, 0x0313, 0x0300, 0x03c5, 0x0314, 0x0300, 0x03c5, 0x0313,
+    0x0301, 0x03c5, 0x0314, 0x0301, 0x03c5, 0x0313, 0x0342, 0x03c5, 0x0314, 0x0342,
+    0x03a5, 0x0314, 0x03a5, 0x0314, 0x0300, 0x03a5, 0x0314, 0x0301, 0x03a5, 0x0314,
+    0x0342, 0x03c9, 0x0313, 0x03c9, 0x0314, 0x03c9, 0x0313, 0x0300, 0x03c9, 0x0314,
+    0x0300, 0x03c9, 0x0313, 0x0301, 0x03c9, 0x0314, 0x0301, 0x03c9, 0x0313, 0x0342,
+    0x03c9, 0x0314, 0x0342, 0x03a9, 0x0313, 0x03a9, 0x0314, 0x03a9, 0x0313, 0x0300,
+    0x03a9, 0x0314, 0x0300, 0x03a9, 0x0313, 0x0301, 0x03a9, 0x0314, 0x0301, 0x03a9,
+    0x0313, 0x0342, 0x03a9, 0x0314, 0x0342, 0x03b1, 0x0300, 0x03b1, 0x0301, 0x03b5,
+    0x0300, 0x03b5, 0x0301, 0x03b7, 0x0300, 0x03b7, 0x0301, 0x03b9, 0x0300, 0x03b9,
+    0x0301, 0x03bf, 0x0300, 0x03bf, 0x0301, 0x03c5, 0x0300, 0x03c5, 0x0301, 0x03c9,
+    0x0300, 0x03c9, 0x0301, 0x03b1, 0x0313, 0x0345, 0x03b1, 0x0314, 0x0345, 0x03b1,
+    0x0313, 0x0300, 0x0345, 0x03b1, 0x0314, 0x0300, 0x0345, 0x03b1, 0x0313, 0x0301,
+    0x0345, 0x03b1, 0x0314, 0x0301, 0x0345, 0x03b1, 0x0313, 0x0342, 0x0345, 0x03b1,
+    0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314, 0x0345, 0x0391,
+    0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300, 0x0345, 0x0391, 0x0313, 0x0301,
+    0x0345, 0x0391, 0x0314, 0x0301, 0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391,
+    0x0314, 0x0342, 0x0345, 0x03b7, 0x0313, 0x0345, 0x03b7, 0x0314, 0x0345, 0x03b7,
+    0x0313, 0x0300, 0x0345, 0x03b7, 0x0314, 0x0300, 0x0345, 0x03b7, 0x0313, 0x0301,
+    0x0345, 0x03b7, 0x0314, 0x0301, 0x0345, 0x03b7, 0x0313, 0x0342, 0x0345, 0x03b7,
+    0x0314, 0x0342, 0x0345, 0x0397, 0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397,
+    0x0313, 0x0300, 0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301,
+    0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342, 0x0345, 0x0397,
+    0x0314, 0x0342, 0x0345, 0x03c9, 0x0313, 0x0345, 0x03c9, 0x0314, 0x0345, 0x03c9,
+    0x0313, 0x0300, 0x0345, 0x03c9, 0x0314, 0x0300, 0x0345, 0x03c9, 0x0313, 0x0301,
+    0x0345, 0x03c9, 0x0314, 0x0301, 0x0345, 0x03c9, 0x0313, 0x0342, 0x0345, 0x03c9,
+    0x0314, 0x0342, 0x0345, 0x03a9, 0x0313, 0x0345, 0x03a9, 0x0314, 0x0345, 0x03a9,
+    0x0313, 0x0300, 0x0345, 0x03a9, 0x0314, 0x0300, 0x0345, 0x03a9, 0x0313, 0x0301,
+    0x0345, 0x03a9, 0x0314, 0x0301, 0x0345, 0x03a9, 0x0313, 0x0342, 0x0345, 0x03a9,
+    0x0314, 0x0342, 0x0345, 0x03b1, 0x0306, 0x03b1, 0x0304, 0x03b1, 0x0300, 0x0345,
+    0x03b1, 0x0345, 0x03b1, 0x0301, 0x0345, 0x03b1, 0x0342, 0x03b1, 0x0342, 0x0345,
+    0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300, 0x0391, 0x0301, 0x0391, 0x0345,
+    0x03b9, 0x00a8, 0x0342, 0x03b7, 0x0300, 0x0345, 0x03b7, 0x0345, 0x03b7, 0x0301,
+    0x0345, 0x03b7, 0x0342, 0x03b7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0395, 0x0301,
+    0x0397, 0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1fbf, 0x0300, 0x1fbf, 0x0301,
+    0x1fbf, 0x0342, 0x03b9, 0x0306, 0x03b9, 0x0304, 0x03b9, 0x0308, 0x0300, 0x03b9,
+    0x0308, 0x0301, 0x03b9, 0x0342, 0x03b9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399,
+    0x0304, 0x0399, 0x0300, 0x0399, 0x0301, 0x1ffe, 0x0300, 0x1ffe, 0x0301, 0x1ffe,
+    0x0342, 0x03c5, 0x0306, 0x03c5, 0x0304, 0x03c5, 0x0308, 0x0300, 0x03c5, 0x0308,
+    0x0301, 0x03c1, 0x0313, 0x03c1, 0x0314, 0x03c5, 0x0342, 0x03c5, 0x0308, 0x0342,
+    0x03a5, 0x0306, 0x03a5, 0x0304, 0x03a5, 0x0300, 0x03a5, 0x0301, 0x03a1, 0x0314,
+    0x00a8, 0x0300, 0x00a8, 0x0301, 0x0060, 0x03c9, 0x0300, 0x0345, 0x03c9, 0x0345,
+    0x03c9, 0x0301, 0x0345, 0x03c9, 0x0342, 0x03c9, 0x0342, 0x0345, 0x039f, 0x0300,
+    0x039f, 0x0301, 0x03a9, 0x0300, 0x03a9, 0x0301, 0x03a9, 0x0345, 0x00b4, 0x2002,
+    0x2003, 0x03a9, 0x004b, 0x0041, 0x030a, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194,
+    0x0338, 0x21d0, 0x0338, 0x21d4, 0x0338, 0x21d2, 0x0338, 0x2203, 0x0338, 0x2208,
+    0x0338, 0x220b, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x223c, 0x0338, 0x2243,
+    0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003d, 0x0338, 0x2261, 0x0338, 0x224d,
+    0x0338, 0x003c, 0x0338, 0x003e, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272,
+    0x0338, 0x2273, 0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227a, 0x0338, 0x227b,
+    0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287, 0x0338, 0x22a2,
+    0x0338, 0x22a8, 0x0338, 0x22a9, 0x0338, 0x22ab, 0x0338, 0x227c, 0x0338, 0x227d,
+    0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22b2, 0x0338, 0x22b3, 0x0338, 0x22b4,
+    0x0338, 0x22b5, 0x0338, 0x3008, 0x3009, 0x2add, 0x0338, 0x304b, 0x3099, 0x304d,
+    0x3099, 0x304f, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057,
+    0x3099, 0x3059, 0x3099, 0x305b, 0x3099, 0x305d, 0x3099, 0x305f, 0x3099, 0x3061,
+    0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f,
+    0x309a, 0x3072, 0x3099, 0x3072, 0x309a, 0x3075, 0x3099, 0x3075, 0x309a, 0x3078,
+    0x3099, 0x3078, 0x309a, 0x307b, 0x3099, 0x307b, 0x309a, 0x3046, 0x3099, 0x309d,
+    0x3099, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30af, 0x3099, 0x30b1, 0x3099, 0x30b3,
+    0x3099, 0x30b5, 0x3099, 0x30b7, 0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd,
+    0x3099, 0x30bf, 0x3099, 0x30c1, 0x3099, 0x30c4, 0x3099, 0x30c6, 0x3099, 0x30c8,
+    0x3099, 0x30cf, 0x3099, 0x30cf, 0x309a, 0x30d2, 0x3099, 0x30d2, 0x309a, 0x30d5,
+    0x3099, 0x30d5, 0x309a, 0x30d8, 0x3099, 0x30d8, 0x309a, 0x30db, 0x3099, 0x30db,
+    0x309a, 0x30a6, 0x3099, 0x30ef, 0x3099, 0x30f0, 0x3099, 0x30f1, 0x3099, 0x30f2,
+    0x3099, 0x30fd, 0x3099, 0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5,
+    0x9f9c, 0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f,
+    0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d, 0x916a, 0x99f1,
+    0x4e82, 0x5375, 0x6b04, 0x721b, 0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964,
+    0x62c9, 0x81d8, 0x881f, 0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7,
+    0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c, 0x8def, 0x9732,
+    0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304, 0x9e7f, 0x8ad6, 0x58df,
+    0x5f04, 0x7c60, 0x807e, 0x7262, 0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13,
+    0x6dda, 0x6f0f, 0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c,
+    0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39, 0x5be7, 0x6012,
+    0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9, 0x4e0d, 0x6ccc, 0x6578, 0x7d22,
+    0x53c3, 0x585e, 0x7701, 0x8449, 0x8aaa, 0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5,
+    0x63a0, 0x7565, 0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf,
+    0x52f5, 0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a, 0x9e97,
+    0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74, 0x6190, 0x6200, 0x649a, 0x6f23,
+    0x7149, 0x7489, 0x79ca, 0x7df4, 0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217,
+    0x52a3, 0x54bd, 0x70c8, 0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e,
+    0x7375, 0x4ee4, 0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046,
+    0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8, 0x60e1, 0x4e86,
+    0x50da, 0x5bee, 0x5c3f, 0x6599, 0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d,
+    0x6688, 0x962e, 0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b,
+    0x7d10, 0x985e, 0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b,
+    0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f, 0x5c65, 0x6613, 0x674e, 0x68a8,
+    0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf, 0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba,
+    0x541d, 0x71d0, 0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+    0x7acb, 0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207,
+    0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x884c, 0x964d, 0x898b,
+    0x5ed3, 0x5140, 0x55c0, 0x585a, 0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e,
+    0x7965, 0x798f, 0x9756, 0x7cbe, 0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef,
+    0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4,
+    0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e, 0x6094, 0x6168,
+    0x618e, 0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e,
+    0x722b, 0x7422, 0x7891, 0x793e, 0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d,
+    0x798e, 0x7a40, 0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed,
+    0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08, 0x8fb6,
+    0x9038, 0x96e3, 0x97ff, 0x983b, 0x6075, 0x242ee, 0x8218, 0x4e26, 0x51b5, 0x5168,
+    0x4f80, 0x5145, 0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a,
+    0x58b3, 0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad, 0x60d8,
+    0x614e, 0x6108, 0x618e, 0x6160, 0x61f2, 0x6234, 0x63c4, 0x641c, 0x6452, 0x6556,
+    0x6674, 0x6717, 0x671b, 0x6756, 0x6b79, 0x6bba, 0x6d41, 0x6edb, 0x6ecb, 0x6f22,
+    0x701e, 0x716e, 0x77a7, 0x7235, 0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d,
+    0x761f, 0x76ca, 0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7bc0, 0x7c7b,
+    0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779, 0x8941, 0x8986, 0x8996,
+    0x8abf, 0x8af8, 0x8acb, 0x8b01, 0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08, 0x8f38,
+    0x9072, 0x9199, 0x9276, 0x967c, 0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b,
+    0x9b12, 0x9f9c, 0x2284a, 0x22844, 0x233d5, 0x3b9d, 0x4018, 0x4039, 0x25249, 0x25cd0,
+    0x27ed3, 0x9f43, 0x9f8e, 0x05d9, 0x05b4, 0x05f2, 0x05b7, 0x05e9, 0x05c1, 0x05e9,
+    0x05c2, 0x05e9, 0x05bc, 0x05c1, 0x05e9, 0x05bc, 0x05c2, 0x05d0, 0x05b7, 0x05d0,
+    0x05b8, 0x05d0, 0x05bc, 0x05d1, 0x05bc, 0x05d2, 0x05bc, 0x05d3, 0x05bc, 0x05d4,
+    0x05bc, 0x05d5, 0x05bc, 0x05d6, 0x05bc, 0x05d8, 0x05bc, 0x05d9, 0x05bc, 0x05da,
+    0x05bc, 0x05db, 0x05bc, 0x05dc, 0x05bc, 0x05de, 0x05bc, 0x05e0, 0x05bc, 0x05e1,
+    0x05bc, 0x05e3, 0x05bc, 0x05e4, 0x05bc, 0x05e6, 0x05bc, 0x05e7, 0x05bc, 0x05e8,
+    0x05bc, 0x05e9, 0x05bc, 0x05ea, 0x05bc, 0x05d5, 0x05b9, 0x05d1, 0x05bf, 0x05db,
+    0x05bf, 0x05e4, 0x05bf, 0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5, 0x110ba, 0x11131,
+    0x11127, 0x11132, 0x11127, 0x11347, 0x1133e, 0x11347, 0x11357, 0x114b9, 0x114ba, 0x114b9,
+    0x114b0, 0x114b9, 0x114bd, 0x115b8, 0x115af, 0x115b9, 0x115af, 0x11935, 0x11930, 0x1d157,
+    0x1d165, 0x1d158, 0x1d165, 0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f, 0x1d158,
+    0x1d165, 0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172, 0x1d1b9, 0x1d165,
+    0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba, 0x1d165, 0x1d16e, 0x1d1b9, 0x1d165,
+    0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f, 0x4e3d, 0x4e38, 0x4e41, 0x20122, 0x4f60, 0x4fae,
+    0x4fbb, 0x5002, 0x507a, 0x5099, 0x50e7, 0x50cf, 0x349e, 0x2063a, 0x514d, 0x5154,
+    0x5164, 0x5177, 0x2051c, 0x34b9, 0x5167, 0x518d, 0x2054b, 0x5197, 0x51a4, 0x4ecc,
+    0x51ac, 0x51b5, 0x291df, 0x51f5, 0x5203, 0x34df, 0x523b, 0x5246, 0x5272, 0x5277,
+    0x3515, 0x52c7, 0x52c9, 0x52e4, 0x52fa, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351,
+    0x535a, 0x5373, 0x537d, 0x537f, 0x537f, 0x537f, 0x20a2c, 0x7070, 0x53ca, 0x53df,
+    0x20b63, 0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6,
+    0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55ab, 0x55b3, 0x55c2, 0x5716,
+    0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58ee, 0x57ce, 0x57f4, 0x580d, 0x578b,
+    0x5832, 0x5831, 0x58ac, 0x214e4, 0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922, 0x5962,
+    0x216a8, 0x216ea, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc, 0x5b08,
+    0x5b3e, 0x5b3e, 0x219c8, 0x5bc3, 0x5bd8, 0x5be7, 0x5bf3, 0x21b18, 0x5bff, 0x5c06,
+    0x5f53, 0x5c22, 0x3781, 0x5c60, 0x5c6e, 0x5cc0, 0x5c8d, 0x21de4, 0x5d43, 0x21de6,
+    0x5d6e, 0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69,
+    0x3862, 0x22183, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0x2a392, 0x5efe, 0x22331,
+    0x22331, 0x8201, 0x5f22, 0x5f22, 0x38c7, 0x232b8, 0x261da, 0x5f62, 0x5f6b, 0x38e3,
+    0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a, 0x391c, 0x6094, 0x226d4, 0x60c7,
+    0x6148, 0x614c, 0x614e, 0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af, 0x61de,
+    0x61f2, 0x61f6, 0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350, 0x22b0c, 0x633d,
+    0x62fc, 0x6368, 0x6383, 0x63e4, 0x22bf1, 0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469,
+    0x647e, 0x649d, 0x6477, 0x3a6c, 0x654f, 0x656c, 0x2300a, 0x65e3, 0x66f8, 0x6649,
+    0x3b19, 0x6691, 0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad, 0x43d9,
+    0x6717, 0x671b, 0x6721, 0x675e, 0x6753, 0x233c3, 0x3b49, 0x67fa, 0x6785, 0x6852,
+    0x6885, 0x2346d, 0x688e, 0x681f, 0x6914, 0x3b9d, 0x6942, 0x69a3, 0x69ea, 0x6aa8,
+    0x236a3, 0x6adb, 0x3c18, 0x6b21, 0x238a7, 0x6b54, 0x3c4e, 0x6b72, 0x6b9f, 0x6bba,
+    0x6bbb, 0x23a8d, 0x21d0b, 0x23afa, 0x6c4e, 0x23cbc, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16,
+    0x6d3e, 0x6d77, 0x6d41, 0x6d69, 0x6d78, 0x6d85, 0x23d1e, 0x6d34, 0x6e2f, 0x6e6e,
+    0x3d33, 0x6ecb, 0x6ec7, 0x23ed1, 0x6df9, 0x6f6e, 0x23f5e, 0x23f8e, 0x6fc6, 0x7039,
+    0x701e, 0x701b, 0x3d96, 0x704a, 0x707d, 0x7077, 0x70ad, 0x20525, 0x7145, 0x24263,
+    0x719c, 0x243ab, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+    0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447, 0x745c, 0x7471, 0x7485,
+    0x74ca, 0x3f1b, 0x7524, 0x24c36, 0x753e, 0x24c92, 0x7570, 0x2219f, 0x7610, 0x24fa1,
+    0x24fb8, 0x25044, 0x3ffc, 0x4008, 0x76f4, 0x250f3, 0x250f2, 0x25119, 0x25133, 0x771e,
+    0x771f, 0x771f, 0x774a, 0x4039, 0x778b, 0x4046, 0x4096, 0x2541d, 0x784e, 0x788c,
+    0x78cc, 0x40e3, 0x25626, 0x7956, 0x2569a, 0x256c5, 0x798f, 0x79eb, 0x412f, 0x7a40,
+    0x7a4a, 0x7a4f, 0x2597c, 0x25aa7, 0x25aa7, 0x7aee, 0x4202, 0x25bab, 0x7bc6, 0x7bc9,
+    0x4227, 0x25c80, 0x7cd2, 0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0x25f86, 0x7d63, 0x4301,
+    0x7dc7, 0x7e02, 0x7e45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262d9, 0x7f7a, 0x2633e,
+    0x7f95, 0x7ffa, 0x8005, 0x264da, 0x26523, 0x8060, 0x265a8, 0x8070, 0x2335f, 0x43d5,
+    0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5, 0x267a7, 0x267b5, 0x23393, 0x2339c, 0x8201,
+    0x8204, 0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd,
+    0x82e6, 0x26b3c, 0x82e5, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7, 0x8457,
+    0x8353, 0x83ca, 0x83cc, 0x83dc, 0x26c36, 0x26d6b, 0x26cd5, 0x452b, 0x84f1, 0x84f3,
+    0x8516, 0x273ca, 0x8564, 0x26f2c, 0x455d, 0x4561, 0x26fb1, 0x270d2, 0x456b, 0x8650,
+    0x865c, 0x8667, 0x8669, 0x86a9, 0x8688, 0x870e, 0x86e2, 0x8779, 0x8728, 0x876b,
+    0x8786, 0x45d7, 0x87e1, 0x8801, 0x45f9, 0x8860, 0x8863, 0x27667, 0x88d7, 0x88de,
+    0x4635, 0x88fa, 0x34bb, 0x278ae, 0x27966, 0x46be, 0x46c7, 0x8aa0, 0x8aed, 0x8b8a,
+    0x8c55, 0x27ca8, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77, 0x27f2f, 0x20804, 0x8dcb, 0x8dbc,
+    0x8df0, 0x208de, 0x8ed4, 0x8f38, 0x285d2, 0x285ed, 0x9094, 0x90f1, 0x9111, 0x2872e,
+    0x911b, 0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0x28bfa, 0x958b, 0x4995,
+    0x95b7, 0x28d77, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0x29145, 0x2921a, 0x4a6e, 0x4a76,
+    0x97e0, 0x2940a, 0x4ab2, 0x29496, 0x980b, 0x980b, 0x9829, 0x295b6, 0x98e2, 0x4b33,
+    0x9929, 0x99a7, 0x99c2, 0x99fe, 0x4bce, 0x29b30, 0x9b12, 0x9c40, 0x9cfd, 0x4cce,
+    0x4ced, 0x9d67, 0x2a0ce, 0x4cf8, 0x2a105, 0x2a20e, 0x2a291, 0x9ebb, 0x4d56, 0x9ef9,
+    0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0x9f3b, 0x2a600,
+};
+
+struct Composition {
+  char32_t first;
+  char32_t second;
+  char32_t composite;
+};
+
+// Primary composites, sorted by (first, second).
+constexpr std::array<Composition, 941> compositions{{
+    {0x003c, 0x0338, 0x226e}, {0x003d, 0x0338, 0x2260}, {0x003e, 0x0338, 0x226f}, {0x0041, 0x0300, 0x00c0},
+    {0x0041, 0x0301, 0x00c1}, {0x0041, 0x0302, 0x00c2}, {0x0041, 0x0303, 0x00c3}, {0x0041, 0x0304, 0x0100},
+    {0x0041, 0x0306, 0x0102}, {0x0041, 0x0307, 0x0226}, {0x0041, 0x0308, 0x00c4}, {0x0041, 0x0309, 0x1ea2},
+    {0x0041, 0x030a, 0x00c5}, {0x0041, 0x030c, 0x01cd}, {0x0041, 0x030f, 0x0200}, {0x0041, 0x0311, 0x0202},
+    {0x0041, 0x0323, 0x1ea0}, {0x0041, 0x0325, 0x1e00}, {0x0041, 0x0328, 0x0104}, {0x0042, 0x0307, 0x1e02},
+    {0x0042, 0x0323, 0x1e04}, {0x0042, 0x0331, 0x1e06}, {0x0043, 0x0301, 0x0106}, {0x0043, 0x0302, 0x0108},
+    {0x0043, 0x0307, 0x010a}, {0x0043, 0x030c, 0x010c}, {0x0043, 0x0327, 0x00c7}, {0x0044, 0x0307, 0x1e0a},
+    {0x0044, 0x030c, 0x010e}, {0x0044, 0x0323, 0x1e0c}, {0x0044, 0x0327, 0x1e10}, {0x0044, 0x032d, 0x1e12},
+    {0x0044, 0x0331, 0x1e0e}, {0x0045, 0x0300, 0x00c8}, {0x0045, 0x0301, 0x00c9}, {0x0045, 0x0302, 0x00ca},
+    {0x0045, 0x0303, 0x1ebc}, {0x0045, 0x0304, 0x0112}, {0x0045, 0x0306, 0x0114}, {0x0045, 0x0307, 0x0116},
+    {0x0045, 0x0308, 0x00cb}, {0x0045, 0x0309, 0x1eba}, {0x0045, 0x030c, 0x011a}, {0x0045, 0x030f, 0x0204},
+    {0x0045, 0x0311, 0x0206}, {0x0045, 0x0323, 0x1eb8}, {0x0045, 0x0327, 0x0228}, {0x0045, 0x0328, 0x0118},
+    {0x0045, 0x032d, 0x1e18}, {0x0045, 0x0330, 0x1e1a}, {0x0046, 0x0307, 0x1e1e}, {0x0047, 0x0301, 0x01f4},
+    {0x0047, 0x0302, 0x011c}, {0x0047, 0x0304, 0x1e20}, {0x0047, 0x0306, 0x011e}, {0x0047, 0x0307, 0x0120},
+    {0x0047, 0x030c, 0x01e6}, {0x0047, 0x0327, 0x0122}, {0x0048, 0x0302, 0x0124}, {0x0048, 0x0307, 0x1e22},
+    {0x0048, 0x0308, 0x1e26}, {0x0048, 0x030c, 0x021e}, {0x0048, 0x0323, 0x1e24}, {0x0048, 0x0327, 0x1e28},
+    {0x0048, 0x032e, 0x1e2a}, {0x0049, 0x0300, 0x00cc}, {0x0049, 0x0301, 0x00cd}, {0x0049, 0x0302, 0x00ce},
+    {0x0049, 0x0303, 0x0128}, {0x0049, 0x0304, 0x012a}, {0x0049, 0x0306, 0x012c}, {0x0049, 0x0307, 0x0130},
+    {0x0049, 0x0308, 0x00cf}, {0x0049, 0x0309, 0x1ec8}, {0x0049, 0x030c, 0x01cf}, {0x0049, 0x030f, 0x0208},
+    {0x0049, 0x0311, 0x020a}, {0x0049, 0x0323, 0x1eca}, {0x0049, 0x0328, 0x012e}, {0x0049, 0x0330, 0x1e2c},
+    {0x004a, 0x0302, 0x0134}, {0x004b, 0x0301, 0x1e30}, {0x004b, 0x030c, 0x01e8}, {0x004b, 0x0323, 0x1e32},
+    {0x004b, 0x0327, 0x0136}, {0x004b, 0x0331, 0x1e34}, {0x004c, 0x0301, 0x0139}, {0x004c, 0x030c, 0x013d},
+    {0x004c, 0x0323, 0x1e36}, {0x004c, 0x0327, 0x013b}, {0x004c, 0x032d, 0x1e3c}, {0x004c, 0x0331, 0x1e3a},
+    {0x004d, 0x0301, 0x1e3e}, {0x004d, 0x0307, 0x1e40}, {0x004d, 0x0323, 0x1e42}, {0x004e, 0x0300, 0x01f8},
+    {0x004e, 0x0301, 0x0143}, {0x004e, 0x0303, 0x00d1}, {0x004e, 0x0307, 0x1e44}, {0x004e, 0x030c, 0x0147},
+    {0x004e, 0x0323, 0x1e46}, {0x004e, 0x0327, 0x0145}, {0x004e, 0x032d, 0x1e4a}, {0x004e, 0x0331, 0x1e48},
+    {0x004f, 0x0300, 0x00d2}, {0x004f, 0x0301, 0x00d3}, {0x004f, 0x0302, 0x00d4}, {0x004f, 0x0303, 0x00d5},
+    {0x004f, 0x0304, 0x014c}, {0x004f, 0x0306, 0x014e}, {0x004f, 0x0307, 0x022e}, {0x004f, 0x0308, 0x00d6},
+    {0x004f, 0x0309, 0x1ece}, {0x004f, 0x030b, 0x0150}, {0x004f, 0x030c, 0x01d1}, {0x004f, 0x030f, 0x020c},
+    {0x004f, 0x0311, 0x020e}, {0x004f, 0x031b, 0x01a0}, {0x004f, 0x0323, 0x1ecc}, {0x004f, 0x0328, 0x01ea},
+    {0x0050, 0x0301, 0x1e54}, {0x0050, 0x0307, 0x1e56}, {0x0052, 0x0301, 0x0154}, {0x0052, 0x0307, 0x1e58},
+    {0x0052, 0x030c, 0x0158}, {0x0052, 0x030f, 0x0210}, {0x0052, 0x0311, 0x0212}, {0x0052, 0x0323, 0x1e5a},
+    {0x0052, 0x0327, 0x0156}, {0x0052, 0x0331, 0x1e5e}, {0x0053, 0x0301, 0x015a}, {0x0053, 0x0302, 0x015c},
+    {0x0053, 0x0307, 0x1e60}, {0x0053, 0x030c, 0x0160}, {0x0053, 0x0323, 0x1e62}, {0x0053, 0x0326, 0x0218},
+    {0x0053, 0x0327, 0x015e}, {0x0054, 0x0307, 0x1e6a}, {0x0054, 0x030c, 0x0164}, {0x0054, 0x0323, 0x1e6c},
+    {0x0054, 0x0326, 0x021a}, {0x0054, 0x0327, 0x0162}, {0x0054, 0x032d, 0x1e70}, {0x0054, 0x0331, 0x1e6e},
+    {0x0055, 0x0300, 0x00d9}, {0x0055, 0x0301, 0x00da}, {0x0055, 0x0302, 0x00db}, {0x0055, 0x0303, 0x0168},
+    {0x0055, 0x0304, 0x016a}, {0x0055, 0x0306, 0x016c}, {0x0055, 0x0308, 0x00dc}, {0x0055, 0x0309, 0x1ee6},
+    {0x0055, 0x030a, 0x016e}, {0x0055, 0x030b, 0x0170}, {0x0055, 0x030c, 0x01d3}, {0x0055, 0x030f, 0x0214},
+    {0x0055, 0x0311, 0x0216}, {0x0055, 0x031b, 0x01af}, {0x0055, 0x0323, 0x1ee4}, {0x0055, 0x0324, 0x1e72},
+    {0x0055, 0x0328, 0x0172}, {0x0055, 0x032d, 0x1e76}, {0x0055, 0x0330, 0x1e74}, {0x0056, 0x0303, 0x1e7c},
+    {0x0056, 0x0323, 0x1e7e}, {0x0057, 0x0300, 0x1e80}, {0x0057, 0x0301, 0x1e82}, {0x0057, 0x0302, 0x0174},
+    {0x0057, 0x0307, 0x1e86}, {0x0057, 0x0308, 0x1e84}, {0x0057, 0x0323, 0x1e88}, {0x0058, 0x0307, 0x1e8a},
+    {0x0058, 0x0308, 0x1e8c}, {0x0059, 0x0300, 0x1ef2}, {0x0059, 0x0301, 0x00dd}, {0x0059, 0x0302, 0x0176},
+    {0x0059, 0x0303, 0x1ef8}, {0x0059, 0x0304, 0x0232}, {0x0059, 0x0307, 0x1e8e}, {0x0059, 0x0308, 0x0178},
+    {0x0059, 0x0309, 0x1ef6}, {0x0059, 0x0323, 0x1ef4}, {0x005a, 0x0301, 0x0179}, {0x005a, 0x0302, 0x1e90},
+    {0x005a, 0x0307, 0x017b}, {0x005a, 0x030c, 0x017d}, {0x005a, 0x0323, 0x1e92}, {0x005a, 0x0331, 0x1e94},
+    {0x0061, 0x0300, 0x00e0}, {0x0061, 0x0301, 0x00e1}, {0x0061, 0x0302, 0x00e2}, {0x0061, 0x0303, 0x00e3},
+    {0x0061, 0x0304, 0x0101}, {0x0061, 0x0306, 0x0103}, {0x0061, 0x0307, 0x0227}, {0x0061, 0x0308, 0x00e4},
+    {0x0061, 0x0309, 0x1ea3}, {0x0061, 0x030a, 0x00e5}, {0x0061, 0x030c, 0x01ce}, {0x0061, 0x030f, 0x0201},
+    {0x0061, 0x0311, 0x0203}, {0x0061, 0x0323, 0x1ea1}, {0x0061, 0x0325, 0x1e01}, {0x0061, 0x0328, 0x0105},
+    {0x0062, 0x0307, 0x1e03}, {0x0062, 0x0323, 0x1e05}, {0x0062, 0x0331, 0x1e07}, {0x0063, 0x0301, 0x0107},
+    {0x0063, 0x0302, 0x0109}, {0x0063, 0x0307, 0x010b}, {0x0063, 0x030c, 0x010d}, {0x0063, 0x0327, 0x00e7},
+    {0x0064, 0x0307, 0x1e0b}, {0x0064, 0x030c, 0x010f}, {0x0064, 0x0323, 0x1e0d}, {0x0064, 0x0327, 0x1e11},
+    {0x0064, 0x032d, 0x1e13}, {0x0064, 0x0331, 0x1e0f}, {0x0065, 0x0300, 0x00e8}, {0x0065, 0x0301, 0x00e9},
+    {0x0065, 0x0302, 0x00ea}, {0x0065, 0x0303, 0x1ebd}, {0x0065, 0x0304, 0x0113}, {0x0065, 0x0306, 0x0115},
+    {0x0065, 0x0307, 0x0117}, {0x0065, 0x0308, 0x00eb}, {0x0065, 0x0309, 0x1ebb}, {0x0065, 0x030c, 0x011b},
+    {0x0065, 0x030f, 0x0205}, {0x0065, 0x0311, 0x0207}, {0x0065, 0x0323, 0x1eb9}, {0x0065, 0x0327, 0x0229},
+    {0x0065, 0x0328, 0x0119}, {0x0065, 0x032d, 0x1e19}, {0x0065, 0x0330, 0x1e1b}, {0x0066, 0x0307, 0x1e1f},
+    {0x0067, 0x0301, 0x01f5}, {0x0067, 0x0302, 0x011d}, {0x0067, 0x0304, 0x1e21}, {0x0067, 0x0306, 0x011f},
+    {0x0067, 0x0307, 0x0121}, {0x0067, 0x030c, 0x01e7}, {0x0067, 0x0327, 0x0123}, {0x0068, 0x0302, 0x0125},
+    {0x0068, 0x0307, 0x1e23}, {0x0068, 0x0308, 0x1e27}, {0x0068, 0x030c, 0x021f}, {0x0068, 0x0323, 0x1e25},
+    {0x0068, 0x0327, 0x1e29}, {0x0068, 0x032e, 0x1e2b}, {0x0068, 0x0331, 0x1e96}, {0x0069, 0x0300, 0x00ec},
+    {0x0069, 0x0301, 0x00ed}, {0x0069, 0x0302, 0x00ee}, {0x0069, 0x0303, 0x0129}, {0x0069, 0x0304, 0x012b},
+    {0x0069, 0x0306, 0x012d}, {0x0069, 0x0308, 0x00ef}, {0x0069, 0x0309, 0x1ec9}, {0x0069, 0x030c, 0x01d0},
+    {0x0069, 0x030f, 0x0209}, {0x0069, 0x0311, 0x020b}, {0x0069, 0x0323, 0x1ecb}, {0x0069, 0x0328, 0x012f},
+    {0x0069, 0x0330, 0x1e2d}, {0x006a, 0x0302, 0x0135}, {0x006a, 0x030c, 0x01f0}, {0x006b, 0x0301, 0x1e31},
+    {0x006b, 0x030c, 0x01e9}, {0x006b, 0x0323, 0x1e33}, {0x006b, 0x0327, 0x0137}, {0x006b, 0x0331, 0x1e35},
+    {0x006c, 0x0301, 0x013a}, {0x006c, 0x030c, 0x013e}, {0x006c, 0x0323, 0x1e37}, {0x006c, 0x0327, 0x013c},
+    {0x006c, 0x032d, 0x1e3d}, {0x006c, 0x0331, 0x1e3b}, {0x006d, 0x0301, 0x1e3f}, {0x006d, 0x0307, 0x1e41},
+    {0x006d, 0x0323, 0x1e43}, {0x006e, 0x0300, 0x01f9}, {0x006e, 0x0301, 0x0144}, {0x006e, 0x0303, 0x00f1},
+    {0x006e, 0x0307, 0x1e45}, {0x006e, 0x030c, 0x0148}, {0x006e, 0x0323, 0x1e47}, {0x006e, 0x0327, 0x0146},
+    {0x006e, 0x032d, 0x1e4b}, {0x006e, 0x0331, 0x1e49}, {0x006f, 0x0300, 0x00f2}, {0x006f, 0x0301, 0x00f3},
+    {0x006f, 0x0302, 0x00f4}, {0x006f, 0x0303, 0x00f5}, {0x006f, 0x0304, 0x014d}, {0x006f, 0x0306, 0x014f},
+    {0x006f, 0x0307, 0x022f}, {0x006f, 0x0308, 0x00f6}, {0x006f, 0x0309, 0x1ecf}, {0x006f, 0x030b, 0x0151},
+    {0x006f, 0x030c, 0x01d2}, {0x006f, 0x030f, 0x020d}, {0x006f, 0x0311, 0x020f}, {0x006f, 0x031b, 0x01a1},
+    {0x006f, 0x0323, 0x1ecd}, {0x006f, 0x0328, 0x01eb}, {0x0070, 0x0301, 0x1e55}, {0x0070, 0x0307, 0x1e57},
+    {0x0072, 0x0301, 0x0155}, {0x0072, 0x0307, 0x1e59}, {0x0072, 0x030c, 0x0159}, {0x0072, 0x030f, 0x0211},
+    {0x0072, 0x0311, 0x0213}, {0x0072, 0x0323, 0x1e5b}, {0x0072, 0x0327, 0x0157}, {0x0072, 0x0331, 0x1e5f},
+    {0x0073, 0x0301, 0x015b}, {0x0073, 0x0302, 0x015d}, {0x0073, 0x0307, 0x1e61}, {0x0073, 0x030c, 0x0161},
+    {0x0073, 0x0323, 0x1e63}, {0x0073, 0x0326, 0x0219}, {0x0073, 0x0327, 0x015f}, {0x0074, 0x0307, 0x1e6b},
+    {0x0074, 0x0308, 0x1e97}, {0x0074, 0x030c, 0x0165}, {0x0074, 0x0323, 0x1e6d}, {0x0074, 0x0326, 0x021b},
+    {0x0074, 0x0327, 0x0163}, {0x0074, 0x032d, 0x1e71}, {0x0074, 0x0331, 0x1e6f}, {0x0075, 0x0300, 0x00f9},
+    {0x0075, 0x0301, 0x00fa}, {0x0075, 0x0302, 0x00fb}, {0x0075, 0x0303, 0x0169}, {0x0075, 0x0304, 0x016b},
+    {0x0075, 0x0306, 0x016d}, {0x0075, 0x0308, 0x00fc}, {0x0075, 0x0309, 0x1ee7}, {0x0075, 0x030a, 0x016f},
+    {0x0075, 0x030b, 0x0171}, {0x0075, 0x030c, 0x01d4}, {0x0075, 0x030f, 0x0215}, {0x0075, 0x0311, 0x0217},
+    {0x0075, 0x031b, 0x01b0}, {0x0075, 0x0323, 0x1ee5}, {0x0075, 0x0324, 0x1e73}, {0x0075, 0x0328, 0x0173},
+    {0x0075, 0x032d, 0x1e77}, {0x0075, 0x0330, 0x1e75}, {0x0076, 0x0303, 0x1e7d}, {0x0076, 0x0323, 0x1e7f},
+    {0x0077, 0x0300, 0x1e81}, {0x0077, 0x0301, 0x1e83}, {0x0077, 0x0302, 0x0175}, {0x0077, 0x0307, 0x1e87},
+    {0x0077, 0x0308, 0x1e85}, {0x0077, 0x030a, 0x1e98}, {0x0077, 0x0323, 0x1e89}, {0x0078, 0x0307, 0x1e8b},
+    {0x0078, 0x0308, 0x1e8d}, {0x0079, 0x0300, 0x1ef3}, {0x0079, 0x0301, 0x00fd}, {0x0079, 0x0302, 0x0177},
+    {0x0079, 0x0303, 0x1ef9}, {0x0079, 0x0304, 0x0233}, {0x0079, 0x0307, 0x1e8f}, {0x0079, 0x0308, 0x00ff},
+    {0x0079, 0x0309, 0x1ef7}, {0x0079, 0x030a, 0x1e99}, {0x0079, 0x0323, 0x1ef5}, {0x007a, 0x0301, 0x017a},
+    {0x007a, 0x0302, 0x1e91}, {0x007a, 0x0307, 0x017c}, {0x007a, 0x030c, 0x017e}, {0x007a, 0x0323, 0x1e93},
+    {0x007a, 0x0331, 0x1e95}, {0x00a8, 0x0300, 0x1fed}, {0x00a8, 0x0301, 0x0385}, {0x00a8, 0x0342, 0x1fc1},
+    {0x00c2, 0x0300, 0x1ea6}, {0x00c2, 0x0301, 0x1ea4}, {0x00c2, 0x0303, 0x1eaa}, {0x00c2, 0x0309, 0x1ea8},
+    {0x00c4, 0x0304, 0x01de}, {0x00c5, 0x0301, 0x01fa}, {0x00c6, 0x0301, 0x01fc}, {0x00c6, 0x0304, 0x01e2},
+    {0x00c7, 0x0301, 0x1e08}, {0x00ca, 0x0300, 0x1ec0}, {0x00ca, 0x0301, 0x1ebe}, {0x00ca, 0x0303, 0x1ec4},
+    {0x00ca, 0x0309, 0x1ec2}, {0x00cf, 0x0301, 0x1e2e}, {0x00d4, 0x0300, 0x1ed2}, {0x00d4, 0x0301, 0x1ed0},
+    {0x00d4, 0x0303, 0x1ed6}, {0x00d4, 0x0309, 0x1ed4}, {0x00d5, 0x0301, 0x1e4c}, {0x00d5, 0x0304, 0x022c},
+    {0x00d5, 0x0308, 0x1e4e}, {0x00d6, 0x0304, 0x022a}, {0x00d8, 0x0301, 0x01fe}, {0x00dc, 0x0300, 0x01db},
+    {0x00dc, 0x0301, 0x01d7}, {0x00dc, 0x0304, 0x01d5}, {0x00dc, 0x030c, 0x01d9}, {0x00e2, 0x0300, 0x1ea7},
+    {0x00e2, 0x0301, 0x1ea5}, {0x00e2, 0x0303, 0x1eab}, {0x00e2, 0x0309, 0x1ea9}, {0x00e4, 0x0304, 0x01df},
+    {0x00e5, 0x0301, 0x01fb}, {0x00e6, 0x0301, 0x01fd}, {0x00e6, 0x0304, 0x01e3}, {0x00e7, 0x0301, 0x1e09},
+    {0x00ea, 0x0300, 0x1ec1}, {0x00ea, 0x0301, 0x1ebf}, {0x00ea, 0x0303, 0x1ec5}, {0x00ea, 0x0309, 0x1ec3},
+    {0x00ef, 0x0301, 0x1e2f}, {0x00f4, 0x0300, 0x1ed3}, {0x00f4, 0x0301, 0x1ed1}, {0x00f4, 0x0303, 0x1ed7},
+    {0x00f4, 0x0309, 0x1ed5}, {0x00f5, 0x0301, 0x1e4d}, {0x00f5, 0x0304, 0x022d}, {0x00f5, 0x0308, 0x1e4f},
+    {0x00f6, 0x0304, 0x022b}, {0x00f8, 0x0301, 0x01ff}, {0x00fc, 0x0300, 0x01dc}, {0x00fc, 0x0301, 0x01d8},
+    {0x00fc, 0x0304, 0x01d6}, {0x00fc, 0x030c, 0x01da}, {0x0102, 0x0300, 0x1eb0}, {0x0102, 0x0301, 0x1eae},
+    {0x0102, 0x0303, 0x1eb4}, {0x0102, 0x0309, 0x1eb2}, {0x0103, 0x0300, 0x1eb1}, {0x0103, 0x0301, 0x1eaf},
+    {0x0103, 0x0303, 0x1eb5}, {0x0103, 0x0309, 0x1eb3}, {0x0112, 0x0300, 0x1e14}, {0x0112, 0x0301, 0x1e16},
+    {0x0113, 0x0300, 0x1e15}, {0x0113, 0x0301, 0x1e17}, {0x014c, 0x0300, 0x1e50}, {0x014c, 0x0301, 0x1e52},
+    {0x014d, 0x0300, 0x1e51}, {0x014d, 0x0301, 0x1e53}, {0x015a, 0x0307, 0x1e64}, {0x015b, 0x0307, 0x1e65},
+    {0x0160, 0x0307, 0x1e66}, {0x0161, 0x0307, 0x1e67}, {0x0168, 0x0301, 0x1e78}, {0x0169, 0x0301, 0x1e79},
+    {0x016a, 0x0308, 0x1e7a}, {0x016b, 0x0308, 0x1e7b}, {0x017f, 0x0307, 0x1e9b}, {0x01a0, 0x0300, 0x1edc},
+    {0x01a0, 0x0301, 0x1eda}, {0x01a0, 0x0303, 0x1ee0}, {0x01a0, 0x0309, 0x1ede}, {0x01a0, 0x0323, 0x1ee2},
+    {0x01a1, 0x0300, 0x1edd}, {0x01a1, 0x0301, 0x1edb}, {0x01a1, 0x0303, 0x1ee1}, {0x01a1, 0x0309, 0x1edf},
+    {0x01a1, 0x0323, 0x1ee3}, {0x01af, 0x0300, 0x1eea}, {0x01af, 0x0301, 0x1ee8}, {0x01af, 0x0303, 0x1eee},
+    {0x01af, 0x0309, 0x1eec}, {0x01af, 0x0323, 0x1ef0}, {0x01b0, 0x0300, 0x1eeb}, {0x01b0, 0x0301, 0x1ee9},
+    {0x01b0, 0x0303, 0x1eef}, {0x01b0, 0x0309, 0x1eed}, {0x01b0, 0x0323, 0x1ef1}, {0x01b7, 0x030c, 0x01ee},
+    {0x01ea, 0x0304, 0x01ec}, {0x01eb, 0x0304, 0x01ed}, {0x0226, 0x0304, 0x01e0}, {0x0227, 0x0304, 0x01e1},
+    {0x0228, 0x0306, 0x1e1c}, {0x0229, 0x0306, 0x1e1d}, {0x022e, 0x0304, 0x0230}, {0x022f, 0x0304, 0x0231},
+    {0x0292, 0x030c, 0x01ef}, {0x0391, 0x0300, 0x1fba}, {0x0391, 0x0301, 0x0386}, {0x0391, 0x0304, 0x1fb9},
+    {0x0391, 0x0306, 0x1fb8}, {0x0391, 0x0313, 0x1f08}, {0x0391, 0x0314, 0x1f09}, {0x0391, 0x0345, 0x1fbc},
+    {0x0395, 0x0300, 0x1fc8}, {0x0395, 0x0301, 0x0388}, {0x0395, 0x0313, 0x1f18}, {0x0395, 0x0314, 0x1f19},
+    {0x0397, 0x0300, 0x1fca}, {0x0397, 0x0301, 0x0389}, {0x0397, 0x0313, 0x1f28}, {0x0397, 0x0314, 0x1f29},
+    {0x0397, 0x0345, 0x1fcc}, {0x0399, 0x0300, 0x1fda}, {0x0399, 0x0301, 0x038a}, {0x0399, 0x0304, 0x1fd9},
+    {0x0399, 0x0306, 0x1fd8}, {0x0399, 0x0308, 0x03aa}, {0x0399, 0x0313, 0x1f38}, {0x0399, 0x0314, 0x1f39},
+    {0x039f, 0x0300, 0x1ff8}, {0x039f, 0x0301, 0x038c}, {0x039f, 0x0313, 0x1f48}, {0x039f, 0x0314, 0x1f49},
+    {0x03a1, 0x0314, 0x1fec}, {0x03a5, 0x0300, 0x1fea}, {0x03a5, 0x0301, 0x038e}, {0x03a5, 0x0304, 0x1fe9},
+    {0x03a5, 0x0306, 0x1fe8}, {0x03a5, 0x0308, 0x03ab}, {0x03a5, 0x0314, 0x1f59}, {0x03a9, 0x0300, 0x1ffa},
+    {0x03a9, 0x0301, 0x038f}, {0x03a9, 0x0313, 0x1f68}, {0x03a9, 0x0314, 0x1f69}, {0x03a9, 0x0345, 0x1ffc},
+    {0x03ac, 0x0345, 0x1fb4}, {0x03ae, 0x0345, 0x1fc4}, {0x03b1, 0x0300, 0x1f70}, {0x03b1, 0x0301, 0x03ac},
+    {0x03b1, 0x0304, 0x1fb1}, {0x03b1, 0x0306, 0x1fb0}, {0x03b1, 0x0313, 0x1f00}, {0x03b1, 0x0314, 0x1f01},
+    {0x03b1, 0x0342, 0x1fb6}, {0x03b1, 0x0345, 0x1fb3}, {0x03b5, 0x0300, 0x1f72}, {0x03b5, 0x0301, 0x03ad},
+    {0x03b5, 0x0313, 0x1f10}, {0x03b5, 0x0314, 0x1f11}, {0x03b7, 0x0300, 0x1f74}, {0x03b7, 0x0301, 0x03ae},
+    {0x03b7, 0x0313, 0x1f20}, {0x03b7, 0x0314, 0x1f21}, {0x03b7, 0x0342, 0x1fc6}, {0x03b7, 0x0345, 0x1fc3},
+    {0x03b9, 0x0300, 0x1f76}, {0x03b9, 0x0301, 0x03af}, {0x03b9, 0x0304, 0x1fd1}, {0x03b9, 0x0306, 0x1fd0},
+    {0x03b9, 0x0308, 0x03ca}, {0x03b9, 0x0313, 0x1f30}, {0x03b9, 0x0314, 0x1f31}, {0x03b9, 0x0342, 0x1fd6},
+    {0x03bf, 0x0300, 0x1f78}, {0x03bf, 0x0301, 0x03cc}, {0x03bf, 0x0313, 0x1f40}, {0x03bf, 0x0314, 0x1f41},
+    {0x03c1, 0x0313, 0x1fe4}, {0x03c1, 0x0314, 0x1fe5}, {0x03c5, 0x0300, 0x1f7a}, {0x03c5, 0x0301, 0x03cd},
+    {0x03c5, 0x0304, 0x1fe1}, {0x03c5, 0x0306, 0x1fe0}, {0x03c5, 0x0308, 0x03cb}, {0x03c5, 0x0313, 0x1f50},
+    {0x03c5, 0x0314, 0x1f51}, {0x03c5, 0x0342, 0x1fe6}, {0x03c9, 0x0300, 0x1f7c}, {0x03c9, 0x0301, 0x03ce},
+    {0x03c9, 0x0313, 0x1f60}, {0x03c9, 0x0314, 0x1f61}, {0x03c9, 0x0342, 0x1ff6}, {0x03c9, 0x0345, 0x1ff3},
+    {0x03ca, 0x0300, 0x1fd2}, {0x03ca, 0x0301, 0x0390}, {0x03ca, 0x0342, 0x1fd7}, {0x03cb, 0x0300, 0x1fe2},
+    {0x03cb, 0x0301, 0x03b0}, {0x03cb, 0x0342, 0x1fe7}, {0x03ce, 0x0345, 0x1ff4}, {0x03d2, 0x0301, 0x03d3},
+    {0x03d2, 0x0308, 0x03d4}, {0x0406, 0x0308, 0x0407}, {0x0410, 0x0306, 0x04d0}, {0x0410, 0x0308, 0x04d2},
+    {0x0413, 0x0301, 0x0403}, {0x0415, 0x0300, 0x0400}, {0x0415, 0x0306, 0x04d6}, {0x0415, 0x0308, 0x0401},
+    {0x0416, 0x0306, 0x04c1}, {0x0416, 0x0308, 0x04dc}, {0x0417, 0x0308, 0x04de}, {0x0418, 0x0300, 0x040d},
+    {0x0418, 0x0304, 0x04e2}, {0x0418, 0x0306, 0x0419}, {0x0418, 0x0308, 0x04e4}, {0x041a, 0x0301, 0x040c},
+    {0x041e, 0x0308, 0x04e6}, {0x0423, 0x0304, 0x04ee}, {0x0423, 0x0306, 0x040e}, {0x0423, 0x0308, 0x04f0},
+    {0x0423, 0x030b, 0x04f2}, {0x0427, 0x0308, 0x04f4}, {0x042b, 0x0308, 0x04f8}, {0x042d, 0x0308, 0x04ec},
+    {0x0430, 0x0306, 0x04d1}, {0x0430, 0x0308, 0x04d3}, {0x0433, 0x0301, 0x0453}, {0x0435, 0x0300, 0x0450},
+    {0x0435, 0x0306, 0x04d7}, {0x0435, 0x0308, 0x0451}, {0x0436, 0x0306, 0x04c2}, {0x0436, 0x0308, 0x04dd},
+    {0x0437, 0x0308, 0x04df}, {0x0438, 0x0300, 0x045d}, {0x0438, 0x0304, 0x04e3}, {0x0438, 0x0306, 0x0439},
+    {0x0438, 0x0308, 0x04e5}, {0x043a, 0x0301, 0x045c}, {0x043e, 0x0308, 0x04e7}, {0x0443, 0x0304, 0x04ef},
+    {0x0443, 0x0306, 0x045e}, {0x0443, 0x0308, 0x04f1}, {0x0443, 0x030b, 0x04f3}, {0x0447, 0x0308, 0x04f5},
+    {0x044b, 0x0308, 0x04f9}, {0x044d, 0x0308, 0x04ed}, {0x0456, 0x0308, 0x0457}, {0x0474, 0x030f, 0x0476},
+    {0x0475, 0x030f, 0x0477}, {0x04d8, 0x0308, 0x04da}, {0x04d9, 0x0308, 0x04db}, {0x04e8, 0x0308, 0x04ea},
+    {0x04e9, 0x0308, 0x04eb}, {0x0627, 0x0653, 0x0622}, {0x0627, 0x0654, 0x0623}, {0x0627, 0x0655, 0x0625},
+    {0x0648, 0x0654, 0x0624}, {0x064a, 0x0654, 0x0626}, {0x06c1, 0x0654, 0x06c2}, {0x06d2, 0x0654, 0x06d3},
+    {0x06d5, 0x0654, 0x06c0}, {0x0928, 0x093c, 0x0929}, {0x0930, 0x093c, 0x0931}, {0x0933, 0x093c, 0x0934},
+    {0x09c7, 0x09be, 0x09cb}, {0x09c7, 0x09d7, 0x09cc}, {0x0b47, 0x0b3e, 0x0b4b}, {0x0b47, 0x0b56, 0x0b48},
+    {0x0b47, 0x0b57, 0x0b4c}, {0x0b92, 0x0bd7, 0x0b94}, {0x0bc6, 0x0bbe, 0x0bca}, {0x0bc6, 0x0bd7, 0x0bcc},
+    {0x0bc7, 0x0bbe, 0x0bcb}, {0x0c46, 0x0c56, 0x0c48}, {0x0cbf, 0x0cd5, 0x0cc0}, {0x0cc6, 0x0cc2, 0x0cca},
+    {0x0cc6, 0x0cd5, 0x0cc7}, {0x0cc6, 0x0cd6, 0x0cc8}, {0x0cca, 0x0cd5, 0x0ccb}, {0x0d46, 0x0d3e, 0x0d4a},
+    {0x0d46, 0x0d57, 0x0d4c}, {0x0d47, 0x0d3e, 0x0d4b}, {0x0dd9, 0x0dca, 0x0dda}, {0x0dd9, 0x0dcf, 0x0ddc},
+    {0x0dd9, 0x0ddf, 0x0dde}, {0x0ddc, 0x0dca, 0x0ddd}, {0x1025, 0x102e, 0x1026}, {0x1b05, 0x1b35, 0x1b06},
+    {0x1b07, 0x1b35, 0x1b08}, {0x1b09, 0x1b35, 0x1b0a}, {0x1b0b, 0x1b35, 0x1b0c}, {0x1b0d, 0x1b35, 0x1b0e},
+    {0x1b11, 0x1b35, 0x1b12}, {0x1b3a, 0x1b35, 0x1b3b}, {0x1b3c, 0x1b35, 0x1b3d}, {0x1b3e, 0x1b35, 0x1b40},
+    {0x1b3f, 0x1b35, 0x1b41}, {0x1b42, 0x1b35, 0x1b43}, {0x1e36, 0x0304, 0x1e38}, {0x1e37, 0x0304, 0x1e39},
+    {0x1e5a, 0x0304, 0x1e5c}, {0x1e5b, 0x0304, 0x1e5d}, {0x1e62, 0x0307, 0x1e68}, {0x1e63, 0x0307, 0x1e69},
+    {0x1ea0, 0x0302, 0x1eac}, {0x1ea0, 0x0306, 0x1eb6}, {0x1ea1, 0x0302, 0x1ead}, {0x1ea1, 0x0306, 0x1eb7},
+    {0x1eb8, 0x0302, 0x1ec6}, {0x1eb9, 0x0302, 0x1ec7}, {0x1ecc, 0x0302, 0x1ed8}, {0x1ecd, 0x0302, 0x1ed9},
+    {0x1f00, 0x0300, 0x1f02}, {0x1f00, 0x0301, 0x1f04}, {0x1f00, 0x0342, 0x1f06}, {0x1f00, 0x0345, 0x1f80},
+    {0x1f01, 0x0300, 0x1f03}, {0x1f01, 0x0301, 0x1f05}, {0x1f01, 0x0342, 0x1f07}, {0x1f01, 0x0345, 0x1f81},
+    {0x1f02, 0x0345, 0x1f82}, {0x1f03, 0x0345, 0x1f83}, {0x1f04, 0x0345, 0x1f84}, {0x1f05, 0x0345, 0x1f85},
+    {0x1f06, 0x0345, 0x1f86}, {0x1f07, 0x0345, 0x1f87}, {0x1f08, 0x0300, 0x1f0a}, {0x1f08, 0x0301, 0x1f0c},
+    {0x1f08, 0x0342, 0x1f0e}, {0x1f08, 0x0345, 0x1f88}, {0x1f09, 0x0300, 0x1f0b}, {0x1f09, 0x0301, 0x1f0d},
+    {0x1f09, 0x0342, 0x1f0f}, {0x1f09, 0x0345, 0x1f89}, {0x1f0a, 0x0345, 0x1f8a}, {0x1f0b, 0x0345, 0x1f8b},
+    {0x1f0c, 0x0345, 0x1f8c}, {0x1f0d, 0x0345, 0x1f8d}, {0x1f0e, 0x0345, 0x1f8e}, {0x1f0f, 0x0345, 0x1f8f},
+    {0x1f10, 0x0300, 0x1f12}, {0x1f10, 0x0301, 0x1f14}, {0x1f11, 0x0300, 0x1f13}, {0x1f11, 0x0301, 0x1f15},
+    {0x1f18, 0x0300, 0x1f1a}, {0x1f18, 0x0301, 0x1f1c}, {0x1f19, 0x0300, 0x1f1b}, {0x1f19, 0x0301, 0x1f1d},
+    {0x1f20, 0x0300, 0x1f22}, {0x1f20, 0x0301, 0x1f24}, {0x1f20, 0x0342, 0x1f26}, {0x1f20, 0x0345, 0x1f90},
+    {0x1f21, 0x0300, 0x1f23}, {0x1f21, 0x0301, 0x1f25}, {0x1f21, 0x0342, 0x1f27}, {0x1f21, 0x0345, 0x1f91},
+    {0x1f22, 0x0345, 0x1f92}, {0x1f23, 0x0345, 0x1f93}, {0x1f24, 0x0345, 0x1f94}, {0x1f25, 0x0345, 0x1f95},
+    {0x1f26, 0x0345, 0x1f96}, {0x1f27, 0x0345, 0x1f97}, {0x1f28, 0x0300, 0x1f2a}, {0x1f28, 0x0301, 0x1f2c},
+    {0x1f28, 0x0342, 0x1f2e}, {0x1f28, 0x0345, 0x1f98}, {0x1f29, 0x0300, 0x1f2b}, {0x1f29, 0x0301, 0x1f2d},
+    {0x1f29, 0x0342, 0x1f2f}, {0x1f29, 0x0345, 0x1f99}, {0x1f2a, 0x0345, 0x1f9a}, {0x1f2b, 0x0345, 0x1f9b},
+    {0x1f2c, 0x0345, 0x1f9c}, {0x1f2d, 0x0345, 0x1f9d}, {0x1f2e, 0x0345, 0x1f9e}, {0x1f2f, 0x0345, 0x1f9f},
+    {0x1f30, 0x0300, 0x1f32}, {0x1f30, 0x0301, 0x1f34}, {0x1f30, 0x0342, 0x1f36}, {0x1f31, 0x0300, 0x1f33},
+    {0x1f31, 0x0301, 0x1f35}, {0x1f31, 0x0342, 0x1f37}, {0x1f38, 0x0300, 0x1f3a}, {0x1f38, 0x0301, 0x1f3c},
+    {0x1f38, 0x0342, 0x1f3e}, {0x1f39, 0x0300, 0x1f3b}, {0x1f39, 0x0301, 0x1f3d}, {0x1f39, 0x0342, 0x1f3f},
+    {0x1f40, 0x0300, 0x1f42}, {0x1f40, 0x0301, 0x1f44}, {0x1f41, 0x0300, 0x1f43}, {0x1f41, 0x0301, 0x1f45},
+    {0x1f48, 0x0300, 0x1f4a}, {0x1f48, 0x0301, 0x1f4c}, {0x1f49, 0x0300, 0x1f4b}, {0x1f49, 0x0301, 0x1f4d},
+    {0x1f50, 0x0300, 0x1f52}, {0x1f50, 0x0301, 0x1f54}, {0x1f50, 0x0342, 0x1f56}, {0x1f51, 0x0300, 0x1f53},
+    {0x1f51, 0x0301, 0x1f55}, {0x1f51, 0x0342, 0x1f57}, {0x1f59, 0x0300, 0x1f5b}, {0x1f59, 0x0301, 0x1f5d},
+    {0x1f59, 0x0342, 0x1f5f}, {0x1f60, 0x0300, 0x1f62}, {0x1f60, 0x0301, 0x1f64}, {0x1f60, 0x0342, 0x1f66},
+    {0x1f60, 0x0345, 0x1fa0}, {0x1f61, 0x0300, 0x1f63}, {0x1f61, 0x0301, 0x1f65}, {0x1f61, 0x0342, 0x1f67},
+    {0x1f61, 0x0345, 0x1fa1}, {0x1f62, 0x0345, 0x1fa2}, {0x1f63, 0x0345, 0x1fa3}, {0x1f64, 0x0345, 0x1fa4},
+    {0x1f65, 0x0345, 0x1fa5}, {0x1f66, 0x0345, 0x1fa6}, {0x1f67, 0x0345, 0x1fa7}, {0x1f68, 0x0300, 0x1f6a},
+    {0x1f68, 0x0301, 0x1f6c}, {0x1f68, 0x0342, 0x1f6e}, {0x1f68, 0x0345, 0x1fa8}, {0x1f69, 0x0300, 0x1f6b},
+    {0x1f69, 0x0301, 0x1f6d}, {0x1f69, 0x0342, 0x1f6f}, {0x1f69, 0x0345, 0x1fa9}, {0x1f6a, 0x0345, 0x1faa},
+    {0x1f6b, 0x0345, 0x1fab}, {0x1f6c, 0x0345, 0x1fac}, {0x1f6d, 0x0345, 0x1fad}, {0x1f6e, 0x0345, 0x1fae},
+    {0x1f6f, 0x0345, 0x1faf}, {0x1f70, 0x0345, 0x1fb2}, {0x1f74, 0x0345, 0x1fc2}, {0x1f7c, 0x0345, 0x1ff2},
+    {0x1fb6, 0x0345, 0x1fb7}, {0x1fbf, 0x0300, 0x1fcd}, {0x1fbf, 0x0301, 0x1fce}, {0x1fbf, 0x0342, 0x1fcf},
+    {0x1fc6, 0x0345, 0x1fc7}, {0x1ff6, 0x0345, 0x1ff7}, {0x1ffe, 0x0300, 0x1fdd}, {0x1ffe, 0x0301, 0x1fde},
+    {0x1ffe, 0x0342, 0x1fdf}, {0x2190, 0x0338, 0x219a}, {0x2192, 0x0338, 0x219b}, {0x2194, 0x0338, 0x21ae},
+    {0x21d0, 0x0338, 0x21cd}, {0x21d2, 0x0338, 0x21cf}, {0x21d4, 0x0338, 0x21ce}, {0x2203, 0x0338, 0x2204},
+    {0x2208, 0x0338, 0x2209}, {0x220b, 0x0338, 0x220c}, {0x2223, 0x0338, 0x2224}, {0x2225, 0x0338, 0x2226},
+    {0x223c, 0x0338, 0x2241}, {0x2243, 0x0338, 0x2244}, {0x2245, 0x0338, 0x2247}, {0x2248, 0x0338, 0x2249},
+    {0x224d, 0x0338, 0x226d}, {0x2261, 0x0338, 0x2262}, {0x2264, 0x0338, 0x2270}, {0x2265, 0x0338, 0x2271},
+    {0x2272, 0x0338, 0x2274}, {0x2273, 0x0338, 0x2275}, {0x2276, 0x0338, 0x2278}, {0x2277, 0x0338, 0x2279},
+    {0x227a, 0x0338, 0x2280}, {0x227b, 0x0338, 0x2281}, {0x227c, 0x0338, 0x22e0}, {0x227d, 0x0338, 0x22e1},
+    {0x2282, 0x0338, 0x2284}, {0x2283, 0x0338, 0x2285}, {0x2286, 0x0338, 0x2288}, {0x2287, 0x0338, 0x2289},
+    {0x2291, 0x0338, 0x22e2}, {0x2292, 0x0338, 0x22e3}, {0x22a2, 0x0338, 0x22ac}, {0x22a8, 0x0338, 0x22ad},
+    {0x22a9, 0x0338, 0x22ae}, {0x22ab, 0x0338, 0x22af}, {0x22b2, 0x0338, 0x22ea}, {0x22b3, 0x0338, 0x22eb},
+    {0x22b4, 0x0338, 0x22ec}, {0x22b5, 0x0338, 0x22ed}, {0x3046, 0x3099, 0x3094}, {0x304b, 0x3099, 0x304c},
+    {0x304d, 0x3099, 0x304e}, {0x304f, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305a}, {0x305b, 0x3099, 0x305c},
+    {0x305d, 0x3099, 0x305e}, {0x305f, 0x3099, 0x3060}, {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069}, {0x306f, 0x3099, 0x3070}, {0x306f, 0x309a, 0x3071},
+    {0x3072, 0x3099, 0x3073}, {0x3072, 0x309a, 0x3074}, {0x3075, 0x3099, 0x3076}, {0x3075, 0x309a, 0x3077},
+    {0x3078, 0x3099, 0x3079}, {0x3078, 0x309a, 0x307a}, {0x307b, 0x3099, 0x307c}, {0x307b, 0x309a, 0x307d},
+    {0x309d, 0x3099, 0x309e}, {0x30a6, 0x3099, 0x30f4}, {0x30ab, 0x3099, 0x30ac}, {0x30ad, 0x3099, 0x30ae},
+    {0x30af, 0x3099, 0x30b0}, {0x30b1, 0x3099, 0x30b2}, {0x30b3, 0x3099, 0x30b4}, {0x30b5, 0x3099, 0x30b6},
+    {0x30b7, 0x3099, 0x30b8}, {0x30b9, 0x3099, 0x30ba}, {0x30bb, 0x3099, 0x30bc}, {0x30bd, 0x3099, 0x30be},
+    {0x30bf, 0x3099, 0x30c0}, {0x30c1, 0x3099, 0x30c2}, {0x30c4, 0x3099, 0x30c5}, {0x30c6, 0x3099, 0x30c7},
+    {0x30c8, 0x3099, 0x30c9}, {0x30cf, 0x3099, 0x30d0}, {0x30cf, 0x309a, 0x30d1}, {0x30d2, 0x3099, 0x30d3},
+    {0x30d2, 0x309a, 0x30d4}, {0x30d5, 0x3099, 0x30d6}, {0x30d5, 0x309a, 0x30d7}, {0x30d8, 0x3099, 0x30d9},
+    {0x30d8, 0x309a, 0x30da}, {0x30db, 0x3099, 0x30dc}, {0x30db, 0x309a, 0x30dd}, {0x30ef, 0x3099, 0x30f7},
+    {0x30f0, 0x3099, 0x30f8}, {0x30f1, 0x3099, 0x30f9}, {0x30f2, 0x3099, 0x30fa}, {0x30fd, 0x3099, 0x30fe},
+    {0x11099, 0x110ba, 0x1109a}, {0x1109b, 0x110ba, 0x1109c}, {0x110a5, 0x110ba, 0x110ab}, {0x11131, 0x11127, 0x1112e},
+    {0x11132, 0x11127, 0x1112f}, {0x11347, 0x1133e, 0x1134b}, {0x11347, 0x11357, 0x1134c}, {0x114b9, 0x114b0, 0x114bc},
+    {0x114b9, 0x114ba, 0x114bb}, {0x114b9, 0x114bd, 0x114be}, {0x115b8, 0x115af, 0x115ba}, {0x115b9, 0x115af, 0x115bb},
+    {0x11935, 0x11930, 0x11938},
+}};
+
+// NFC_Quick_Check=No, excluding Hangul syllables.
+constexpr std::array<CodePointRange, 73> nfc_qc_no_ranges{{
+    {0x0340, 0x0341}, {0x0343, 0x0344}, {0x0374, 0x0374}, {0x037e, 0x037e}, {0x0387, 0x0387}, {0x0958, 0x095f},
+    {0x09dc, 0x09dd}, {0x09df, 0x09df}, {0x0a33, 0x0a33}, {0x0a36, 0x0a36}, {0x0a59, 0x0a5b}, {0x0a5e, 0x0a5e},
+    {0x0b5c, 0x0b5d}, {0x0f43, 0x0f43}, {0x0f4d, 0x0f4d}, {0x0f52, 0x0f52}, {0x0f57, 0x0f57}, {0x0f5c, 0x0f5c},
+    {0x0f69, 0x0f69}, {0x0f73, 0x0f73}, {0x0f75, 0x0f76}, {0x0f78, 0x0f78}, {0x0f81, 0x0f81}, {0x0f93, 0x0f93},
+    {0x0f9d, 0x0f9d}, {0x0fa2, 0x0fa2}, {0x0fa7, 0x0fa7}, {0x0fac, 0x0fac}, {0x0fb9, 0x0fb9}, {0x1f71, 0x1f71},
+    {0x1f73, 0x1f73}, {0x1f75, 0x1f75}, {0x1f77, 0x1f77}, {0x1f79, 0x1f79}, {0x1f7b, 0x1f7b}, {0x1f7d, 0x1f7d},
+    {0x1fbb, 0x1fbb}, {0x1fbe, 0x1fbe}, {0x1fc9, 0x1fc9}, {0x1fcb, 0x1fcb}, {0x1fd3, 0x1fd3}, {0x1fdb, 0x1fdb},
+    {0x1fe3, 0x1fe3}, {0x1feb, 0x1feb}, {0x1fee, 0x1fef}, {0x1ff9, 0x1ff9}, {0x1ffb, 0x1ffb}, {0x1ffd, 0x1ffd},
+    {0x2000, 0x2001}, {0x2126, 0x2126}, {0x212a, 0x212b}, {0x2329, 0x232a}, {0x2adc, 0x2adc}, {0xf900, 0xfa0d},
+    {0xfa10, 0xfa10}, {0xfa12, 0xfa12}, {0xfa15, 0xfa1e}, {0xfa20, 0xfa20}, {0xfa22, 0xfa22}, {0xfa25, 0xfa26},
+    {0xfa2a, 0xfa6d}, {0xfa70, 0xfad9}, {0xfb1d, 0xfb1d}, {0xfb1f, 0xfb1f}, {0xfb2a, 0xfb36}, {0xfb38, 0xfb3c},
+    {0xfb3e, 0xfb3e}, {0xfb40, 0xfb41}, {0xfb43, 0xfb44}, {0xfb46, 0xfb4e}, {0x1d15e, 0x1d164}, {0x1d1bb, 0x1d1c0},
+    {0x2f800, 0x2fa1d},
+}};
+
+// NFC_Quick_Check=Maybe: code points that can combine with a preceding one.
+constexpr std::array<CodePointRange, 42> nfc_qc_maybe_ranges{{
+    {0x0300, 0x0304}, {0x0306, 0x030c}, {0x030f, 0x030f}, {0x0311, 0x0311}, {0x0313, 0x0314}, {0x031b, 0x031b},
+    {0x0323, 0x0328}, {0x032d, 0x032e}, {0x0330, 0x0331}, {0x0338, 0x0338}, {0x0342, 0x0342}, {0x0345, 0x0345},
+    {0x0653, 0x0655}, {0x093c, 0x093c}, {0x09be, 0x09be}, {0x09d7, 0x09d7}, {0x0b3e, 0x0b3e}, {0x0b56, 0x0b57},
+    {0x0bbe, 0x0bbe}, {0x0bd7, 0x0bd7}, {0x0c56, 0x0c56}, {0x0cc2, 0x0cc2}, {0x0cd5, 0x0cd6}, {0x0d3e, 0x0d3e},
+    {0x0d57, 0x0d57}, {0x0dca, 0x0dca}, {0x0dcf, 0x0dcf}, {0x0ddf, 0x0ddf}, {0x102e, 0x102e}, {0x1161, 0x1175},
+    {0x11a8, 0x11c2}, {0x1b35, 0x1b35}, {0x3099, 0x309a}, {0x110ba, 0x110ba}, {0x11127, 0x11127}, {0x1133e, 0x1133e},
+    {0x11357, 0x11357}, {0x114b0, 0x114b0}, {0x114ba, 0x114ba}, {0x114bd, 0x114bd}, {0x115af, 0x115af}, {0x11930, 0x11930},
+}};
+
+// Case folding
+
+struct CaseFoldRange {
+  char32_t first;
+  char32_t last;
+  int32_t delta;
+  uint8_t stride;  // Every `stride`th code point from `first` folds
+};
+
+// Simple case folding (CaseFolding.txt statuses C and S) as runs of code
+// points that fold by the same delta.
+constexpr std::array<CaseFoldRange, 202> simple_fold_ranges{{
+    {0x0041, 0x005a, 32, 1}, {0x00b5, 0x00b5, 775, 1}, {0x00c0, 0x00d6, 32, 1}, {0x00d8, 0x00de, 32, 1}, {0x0100, 0x012e, 1, 2},
+    {0x0132, 0x0136, 1, 2}, {0x0139, 0x0147, 1, 2}, {0x014a, 0x0176, 1, 2}, {0x0178, 0x0178, -121, 1}, {0x0179, 0x017d, 1, 2},
+    {0x017f, 0x017f, -268, 1}, {0x0181, 0x0181, 210, 1}, {0x0182, 0x0184, 1, 2}, {0x0186, 0x0186, 206, 1}, {0x0187, 0x0187, 1, 1},
+    {0x0189, 0x018a, 205, 1}, {0x018b, 0x018b, 1, 1}, {0x018e, 0x018e, 79, 1}, {0x018f, 0x018f, 202, 1}, {0x0190, 0x0190, 203, 1},
+    {0x0191, 0x0191, 1, 1}, {0x0193, 0x0193, 205, 1}, {0x0194, 0x0194, 207, 1}, {0x0196, 0x0196, 211, 1}, {0x0197, 0x0197, 209, 1},
+    {0x0198, 0x0198, 1, 1}, {0x019c, 0x019c, 211, 1}, {0x019d, 0x019d, 213, 1}, {0x019f, 0x019f, 214, 1}, {0x01a0, 0x01a4, 1, 2},
+    {0x01a6, 0x01a6, 218, 1}, {0x01a7, 0x01a7, 1, 1}, {0x01a9, 0x01a9, 218, 1}, {0x01ac, 0x01ac, 1, 1}, {0x01ae, 0x01ae, 218, 1},
+    {0x01af, 0x01af, 1, 1}, {0x01b1, 0x01b2, 217, 1}, {0x01b3, 0x01b5, 1, 2}, {0x01b7, 0x01b7, 219, 1}, {0x01b8, 0x01b8, 1, 1},
+    {0x01bc, 0x01bc, 1, 1}, {0x01c4, 0x01c4, 2, 1}, {0x01c5, 0x01c5, 1, 1}, {0x01c7, 0x01c7, 2, 1}, {0x01c8, 0x01c8, 1, 1},
+    {0x01ca, 0x01ca, 2, 1}, {0x01cb, 0x01db, 1, 2}, {0x01de, 0x01ee, 1, 2}, {0x01f1, 0x01f1, 2, 1}, {0x01f2, 0x01f4, 1, 2},
+    {0x01f6, 0x01f6, -97, 1}, {0x01f7, 0x01f7, -56, 1}, {0x01f8, 0x021e, 1, 2}, {0x0220, 0x0220, -130, 1}, {0x0222, 0x0232, 1, 2},
+    {0x023a, 0x023a, 10795, 1}, {0x023b, 0x023b, 1, 1}, {0x023d, 0x023d, -163, 1}, {0x023e, 0x023e, 10792, 1}, {0x0241, 0x0241, 1, 1},
+    {0x0243, 0x0243, -195, 1}, {0x0244, 0x0244, 69, 1}, {0x0245, 0x0245, 71, 1}, {0x0246, 0x024e, 1, 2}, {0x0345, 0x0345, 116, 1},
+    {0x0370, 0x0372, 1, 2}, {0x0376, 0x0376, 1, 1}, {0x037f, 0x037f, 116, 1}, {0x0386, 0x0386, 38, 1}, {0x0388, 0x038a, 37, 1},
+    {0x038c, 0x038c, 64, 1}, {0x038e, 0x038f, 63, 1}, {0x0391, 0x03a1, 32, 1}, {0x03a3, 0x03ab, 32, 1}, {0x03c2, 0x03c2, 1, 1},
+    {0x03cf, 0x03cf, 8, 1}, {0x03d0, 0x03d0, -30, 1}, {0x03d1, 0x03d1, -25, 1}, {0x03d5, 0x03d5, -15, 1}, {0x03d6, 0x03d6, -22, 1},
+    {0x03d8, 0x03ee, 1, 2}, {0x03f0, 0x03f0, -54, 1}, {0x03f1, 0x03f1, -48, 1}, {0x03f4, 0x03f4, -60, 1}, {0x03f5, 0x03f5, -64, 1},
+    {0x03f7, 0x03f7, 1, 1}, {0x03f9, 0x03f9, -7, 1}, {0x03fa, 0x03fa, 1, 1}, {0x03fd, 0x03ff, -130, 1}, {0x0400, 0x040f, 80, 1},
+    {0x0410, 0x042f, 32, 1}, {0x0460, 0x0480, 1, 2}, {0x048a, 0x04be, 1, 2}, {0x04c0, 0x04c0, 15, 1}, {0x04c1, 0x04cd, 1, 2},
+    {0x04d0, 0x052e, 1, 2}, {0x0531, 0x0556, 48, 1}, {0x10a0, 0x10c5, 7264, 1}, {0x10c7, 0x10c7, 7264, 1}, {0x10cd, 0x10cd, 7264, 1},
+    {0x13f8, 0x13fd, -8, 1}, {0x1c80, 0x1c80, -6222, 1}, {0x1c81, 0x1c81, -6221, 1}, {0x1c82, 0x1c82, -6212, 1}, {0x1c83, 0x1c84, -6210, 1},
+    {0x1c85, 0x1c85, -6211, 1}, {0x1c86, 0x1c86, -6204, 1}, {0x1c87, 0x1c87, -6180, 1}, {0x1c88, 0x1c88, 35267, 1}, {0x1c90, 0x1cba, -3008, 1},
+    {0x1cbd, 0x1cbf, -3008, 1}, {0x1e00, 0x1e94, 1, 2}, {0x1e9b, 0x1e9b, -58, 1}, {0x1e9e, 0x1e9e, -7615, 1}, {0x1ea0, 0x1efe, 1, 2},
+    {0x1f08, 0x1f0f, -8, 1}, {0x1f18, 0x1f1d, -8, 1}, {0x1f28, 0x1f2f, -8, 1}, {0x1f38, 0x1f3f, -8, 1}, {0x1f48, 0x1f4d, -8, 1},
+    {0x1f59, 0x1f5f, -8, 2}, {0x1f68, 0x1f6f, -8, 1}, {0x1f88, 0x1f8f, -8, 1}, {0x1f98, 0x1f9f, -8, 1}, {0x1fa8, 0x1faf, -8, 1},
+    {0x1fb8, 0x1fb9, -8, 1}, {0x1fba, 0x1fbb, -74, 1}, {0x1fbc, 0x1fbc, -9, 1}, {0x1fbe, 0x1fbe, -7173, 1}, {0x1fc8, 0x1fcb, -86, 1},
+    {0x1fcc, 0x1fcc, -9, 1}, {0x1fd8, 0x1fd9, -8, 1}, {0x1fda, 0x1fdb, -100, 1}, {0x1fe8, 0x1fe9, -8, 1}, {0x1fea, 0x1feb, -112, 1},
+    {0x1fec, 0x1fec, -7, 1}, {0x1ff8, 0x1ff9, -128, 1}, {0x1ffa, 0x1ffb, -126, 1}, {0x1ffc, 0x1ffc, -9, 1}, {0x2126, 0x2126, -7517, 1},
+    {0x212a, 0x212a, -8383, 1}, {0x212b, 0x212b, -8262, 1}, {0x2132, 0x2132, 28, 1}, {0x2160, 0x216f, 16, 1}, {0x2183, 0x2183, 1, 1},
+    {0x24b6, 0x24cf, 26, 1}, {0x2c00, 0x2c2f, 48, 1}, {0x2c60, 0x2c60, 1, 1}, {0x2c62, 0x2c62, -10743, 1}, {0x2c63, 0x2c63, -3814, 1},
+    {0x2c64, 0x2c64, -10727, 1}, {0x2c67, 0x2c6b, 1, 2}, {0x2c6d, 0x2c6d, -10780, 1}, {0x2c6e, 0x2c6e, -10749, 1}, {0x2c6f, 0x2c6f, -10783, 1},
+    {0x2c70, 0x2c70, -10782, 1}, {0x2c72, 0x2c72, 1, 1}, {0x2c75, 0x2c75, 1, 1}, {0x2c7e, 0x2c7f, -10815, 1}, {0x2c80, 0x2ce2, 1, 2},
+    {0x2ceb, 0x2ced, 1, 2}, {0x2cf2, 0x2cf2, 1, 1}, {0xa640, 0xa66c, 1, 2}, {0xa680, 0xa69a, 1, 2}, {0xa722, 0xa72e, 1, 2},
+    {0xa732, 0xa76e, 1, 2}, {0xa779, 0xa77b, 1, 2}, {0xa77d, 0xa77d, -35332, 1}, {0xa77e, 0xa786, 1, 2}, {0xa78b, 0xa78b, 1, 1},
+    {0xa78d, 0xa78d, -42280, 1}, {0xa790, 0xa792, 1, 2}, {0xa796, 0xa7a8, 1, 2}, {0xa7aa, 0xa7aa, -42308, 1}, {0xa7ab, 0xa7ab, -42319, 1},
+    {0xa7ac, 0xa7ac, -42315, 1}, {0xa7ad, 0xa7ad, -42305, 1}, {0xa7ae, 0xa7ae, -42308, 1}, {0xa7b0, 0xa7b0, -42258, 1}, {0xa7b1, 0xa7b1, -42282, 1},
+    {0xa7b2, 0xa7b2, -42261, 1}, {0xa7b3, 0xa7b3, 928, 1}, {0xa7b4, 0xa7c2, 1, 2}, {0xa7c4, 0xa7c4, -48, 1}, {0xa7c5, 0xa7c5, -42307, 1},
+    {0xa7c6, 0xa7c6, -35384, 1}, {0xa7c7, 0xa7c9, 1, 2}, {0xa7d0, 0xa7d0, 1, 1}, {0xa7d6, 0xa7d8, 1, 2}, {0xa7f5, 0xa7f5, 1, 1},
+    {0xab70, 0xabbf, -38864, 1}, {0xff21, 0xff3a, 32, 1}, {0x10400, 0x10427, 40, 1}, {0x104b0, 0x104d3, 40, 1}, {0x10570, 0x1057a, 39, 1},
+    {0x1057c, 0x1058a, 39, 1}, {0x1058c, 0x10592, 39, 1}, {0x10594, 0x10595, 39, 1}, {0x10c80, 0x10cb2, 64, 1}, {0x118a0, 0x118bf, 32, 1},
+    {0x16e40, 0x16e5f, 32, 1}, {0x1e900, 0x1e921, 34, 1},
+}};
+
+struct FullCaseFold {
+  char32_t cp;
+  std::array<char32_t, 3> folded;  // Zero padded
+};
+
+// Full case foldings that expand to more than one code point (status F).
+constexpr std::array<FullCaseFold, 104> full_folds{{
+    {0x00df, {0x0073, 0x0073, 0x0000}}, {0x0130, {0x0069, 0x0307, 0x0000}}, {0x0149, {0x02bc, 0x006e, 0x0000}},
+    {0x01f0, {0x006a, 0x030c, 0x0000}}, {0x0390, {0x03b9, 0x0308, 0x0301}}, {0x03b0, {0x03c5, 0x0308, 0x0301}},
+    {0x0587, {0x0565, 0x0582, 0x0000}}, {0x1e96, {0x0068, 0x0331, 0x0000}}, {0x1e97, {0x0074, 0x0308, 0x0000}},
+    {0x1e98, {0x0077, 0x030a, 0x0000}}, {0x1e99, {0x0079, 0x030a, 0x0000}}, {0x1e9a, {0x0061, 0x02be, 0x0000}},
+    {0x1e9e, {0x0073, 0x0073, 0x0000}}, {0x1f50, {0x03c5, 0x0313, 0x0000}}, {0x1f52, {0x03c5, 0x0313, 0x0300}},
+    {0x1f54, {0x03c5, 0x0313, 0x0301}}, {0x1f56, {0x03c5, 0x0313, 0x0342}}, {0x1f80, {0x1f00, 0x03b9, 0x0000}},
+    {0x1f81, {0x1f01, 0x03b9, 0x0000}}, {0x1f82, {0x1f02, 0x03b9, 0x0000}}, {0x1f83, {0x1f03, 0x03b9, 0x0000}},
+    {0x1f84, {0x1f04, 0x03b9, 0x0000}}, {0x1f85, {0x1f05, 0x03b9, 0x0000}}, {0x1f86, {0x1f06, 0x03b9, 0x0000}},
+    {0x1f87, {0x1f07, 0x03b9, 0x0000}}, {0x1f88, {0x1f00, 0x03b9, 0x0000}}, {0x1f89, {0x1f01, 0x03b9, 0x0000}},
+    {0x1f8a, {0x1f02, 0x03b9, 0x0000}}, {0x1f8b, {0x1f03, 0x03b9, 0x0000}}, {0x1f8c, {0x1f04, 0x03b9, 0x0000}},
+    {0x1f8d, {0x1f05, 0x03b9, 0x0000}}, {0x1f8e, {0x1f06, 0x03b9, 0x0000}}, {0x1f8f, {0x1f07, 0x03b9, 0x0000}},
+    {0x1f90, {0x1f20, 0x03b9, 0x0000}}, {0x1f91, {0x1f21, 0x03b9, 0x0000}}, {0x1f92, {0x1f22, 0x03b9, 0x0000}},
+    {0x1f93, {0x1f23, 0x03b9, 0x0000}}, {0x1f94, {0x1f24, 0x03b9, 0x0000}}, {0x1f95, {0x1f25, 0x03b9, 0x0000}},
+    {0x1f96, {0x1f26, 0x03b9, 0x0000}}, {0x1f97, {0x1f27, 0x03b9, 0x0000}}, {0x1f98, {0x1f20, 0x03b9, 0x0000}},
+    {0x1f99, {0x1f21, 0x03b9, 0x0000}}, {0x1f9a, {0x1f22, 0x03b9, 0x0000}}, {0x1f9b, {0x1f23, 0x03b9, 0x0000}},
+    {0x1f9c, {0x1f24, 0x03b9, 0x0000}}, {0x1f9d, {0x1f25, 0x03b9, 0x0000}}, {0x1f9e, {0x1f26, 0x03b9, 0x0000}},
+    {0x1f9f, {0x1f27, 0x03b9, 0x0000}}, {0x1fa0, {0x1f60, 0x03b9, 0x0000}}, {0x1fa1, {0x1f61, 0x03b9, 0x0000}},
+    {0x1fa2, {0x1f62, 0x03b9, 0x0000}}, {0x1fa3, {0x1f63, 0x03b9, 0x0000}}, {0x1fa4, {0x1f64, 0x03b9, 0x0000}},
+    {0x1fa5, {0x1f65, 0x03b9, 0x0000}}, {0x1fa6, {0x1f66, 0x03b9, 0x0000}}, {0x1fa7, {0x1f67, 0x03b9, 0x0000}},
+    {0x1fa8, {0x1f60, 0x03b9, 0x0000}}, {0x1fa9, {0x1f61, 0x03b9, 0x0000}}, {0x1faa, {0x1f62, 0x03b9, 0x0000}},
+    {0x1fab, {0x1f63, 0x03b9, 0x0000}}, {0x1fac, {0x1f64, 0x03b9, 0x0000}}, {0x1fad, {0x1f65, 0x03b9, 0x0000}},
+    {0x1fae, {0x1f66, 0x03b9, 0x0000}}, {0x1faf, {0x1f67, 0x03b9, 0x0000}}, {0x1fb2, {0x1f70, 0x03b9, 0x0000}},
+    {0x1fb3, {0x03b1, 0x03b9, 0x0000}}, {0x1fb4, {0x03ac, 0x03b9, 0x0000}}, {0x1fb6, {0x03b1, 0x0342, 0x0000}},
+    {0x1fb7, {0x03b1, 0x0342, 0x03b9}}, {0x1fbc, {0x03b1, 0x03b9, 0x0000}}, {0x1fc2, {0x1f74, 0x03b9, 0x0000}},
+    {0x1fc3, {0x03b7, 0x03b9, 0x0000}}, {0x1fc4, {0x03ae, 0x03b9, 0x0000}}, {0x1fc6, {0x03b7, 0x0342, 0x0000}},
+    {0x1fc7, {0x03b7, 0x0342, 0x03b9}}, {0x1fcc, {0x03b7, 0x03b9, 0x0000}}, {0x1fd2, {0x03b9, 0x0308, 0x0300}},
+    {0x1fd3, {0x03b9, 0x0308, 0x0301}}, {0x1fd6, {0x03b9, 0x0342, 0x0000}}, {0x1fd7, {0x03b9, 0x0308, 0x0342}},
+    {0x1fe2, {0x03c5, 0x0308, 0x0300}}, {0x1fe3, {0x03c5, 0x0308, 0x0301}}, {0x1fe4, {0x03c1, 0x0313, 0x0000}},
+    {0x1fe6, {0x03c5, 0x0342, 0x0000}}, {0x1fe7, {0x03c5, 0x0308, 0x0342}}, {0x1ff2, {0x1f7c, 0x03b9, 0x0000}},
+    {0x1ff3, {0x03c9, 0x03b9, 0x0000}}, {0x1ff4, {0x03ce, 0x03b9, 0x0000}}, {0x1ff6, {0x03c9, 0x0342, 0x0000}},
+    {0x1ff7, {0x03c9, 0x0342, 0x03b9}}, {0x1ffc, {0x03c9, 0x03b9, 0x0000}}, {0xfb00, {0x0066, 0x0066, 0x0000}},
+    {0xfb01, {0x0066, 0x0069, 0x0000}}, {0xfb02, {0x0066, 0x006c, 0x0000}}, {0xfb03, {0x0066, 0x0066, 0x0069}},
+    {0xfb04, {0x0066, 0x0066, 0x006c}}, {0xfb05, {0x0073, 0x0074, 0x0000}}, {0xfb06, {0x0073, 0x0074, 0x0000}},
+    {0xfb13, {0x0574, 0x0576, 0x0000}}, {0xfb14, {0x0574, 0x0565, 0x0000}}, {0xfb15, {0x0574, 0x056b, 0x0000}},
+    {0xfb16, {0x057e, 0x0576, 0x0000}}, {0xfb17, {0x0574, 0x056d, 0x0000}},
+}};
+
+// Word segmentation
+
+// Simplified UAX #29 Word_Break classes. Letters of scripts written without
+// spaces count as ALetter; Han and Hiragana are Ideographic and break around
+// every character.
+enum class WordClass : uint8_t {
+  Other,
+  ALetter,
+  Numeric,
+  Katakana,
+  Ideographic,
+  MidLetter,
+  MidNum,
+  MidNumLet,
+  SingleQuote,
+  ExtendNumLet,
+  Extend,
+};
+
+// Runs of code points sharing a WordClass, as (first << 8) | class. A run
+// lasts until the next one starts.
+constexpr std::array<uint32_t, 1853> word_class_runs{
+    0x00000000, 0x00002708, 0x00002800, 0x00002c06, 0x00002d00, 0x00002e07, 0x00002f00, 0x00003002,
+    0x00003a05, 0x00003b06, 0x00003c00, 0x00004101, 0x00005b00, 0x00005f09, 0x00006000, 0x00006101,
+    0x00007b00, 0x0000aa01, 0x0000ab00, 0x0000ad0a, 0x0000ae00, 0x0000b501, 0x0000b600, 0x0000b705,
+    0x0000b800, 0x0000ba01, 0x0000bb00, 0x0000c001, 0x0000d700, 0x0000d801, 0x0000f700, 0x0000f801,
+    0x0002c200, 0x0002c601, 0x0002d200, 0x0002e001, 0x0002e500, 0x0002ec01, 0x0002ed00, 0x0002ee01,
+    0x0002ef00, 0x0003000a, 0x00037001, 0x00037500, 0x00037601, 0x00037800, 0x00037a01, 0x00037e06,
+    0x00037f01, 0x00038000, 0x00038601, 0x00038705, 0x00038801, 0x00038b00, 0x00038c01, 0x00038d00,
+    0x00038e01, 0x0003a200, 0x0003a301, 0x0003f600, 0x0003f701, 0x00048200, 0x0004830a, 0x00048a01,
+    0x00053000, 0x00053101, 0x00055700, 0x00055901, 0x00055a00, 0x00055f05, 0x00056001, 0x00058906,
+    0x00058a00, 0x0005910a, 0x0005be00, 0x0005bf0a, 0x0005c000, 0x0005c10a, 0x0005c300, 0x0005c40a,
+    0x0005c600, 0x0005c70a, 0x0005c800, 0x0005d001, 0x0005eb00, 0x0005ef01, 0x0005f300, 0x0005f405,
+    0x0005f500, 0x0006000a, 0x00060600, 0x00060c06, 0x00060e00, 0x0006100a, 0x00061b00, 0x00061c0a,
+    0x00061d00, 0x00062001, 0x00064b0a, 0x00066002, 0x00066a00, 0x00066c06, 0x00066d00, 0x00066e01,
+    0x0006700a, 0x00067101, 0x0006d400, 0x0006d501, 0x0006d60a, 0x0006de00, 0x0006df0a, 0x0006e501,
+    0x0006e70a, 0x0006e900, 0x0006ea0a, 0x0006ee01, 0x0006f002, 0x0006fa01, 0x0006fd00, 0x0006ff01,
+    0x00070000, 0x00070f0a, 0x00071001, 0x0007110a, 0x00071201, 0x0007300a, 0x00074b00, 0x00074d01,
+    0x0007a60a, 0x0007b101, 0x0007b200, 0x0007c002, 0x0007ca01, 0x0007eb0a, 0x0007f401, 0x0007f600,
+    0x0007f806, 0x0007f900, 0x0007fa01, 0x0007fb00, 0x0007fd0a, 0x0007fe00, 0x00080001, 0x0008160a,
+    0x00081a01, 0x00081b0a, 0x00082401, 0x0008250a, 0x00082801, 0x0008290a, 0x00082e00, 0x00084001,
+    0x0008590a, 0x00085c00, 0x00086001, 0x00086b00, 0x00087001, 0x00088800, 0x00088901, 0x00088f00,
+    0x0008900a, 0x00089200, 0x0008980a, 0x0008a001, 0x0008ca0a, 0x00090401, 0x00093a0a, 0x00093d01,
+    0x00093e0a, 0x00095001, 0x0009510a, 0x00095801, 0x0009620a, 0x00096400, 0x00096602, 0x00097000,
+    0x00097101, 0x0009810a, 0x00098400, 0x00098501, 0x00098d00, 0x00098f01, 0x00099100, 0x00099301,
+    0x0009a900, 0x0009aa01, 0x0009b100, 0x0009b201, 0x0009b300, 0x0009b601, 0x0009ba00, 0x0009bc0a,
+    0x0009bd01, 0x0009be0a, 0x0009c500, 0x0009c70a, 0x0009c900, 0x0009cb0a, 0x0009ce01, 0x0009cf00,
+    0x0009d70a, 0x0009d800, 0x0009dc01, 0x0009de00, 0x0009df01, 0x0009e20a, 0x0009e400, 0x0009e602,
+    0x0009f001, 0x0009f200, 0x0009fc01, 0x0009fd00, 0x0009fe0a, 0x0009ff00, 0x000a010a, 0x000a0400,
+    0x000a0501, 0x000a0b00, 0x000a0f01, 0x000a1100, 0x000a1301, 0x000a2900, 0x000a2a01, 0x000a3100,
+    0x000a3201, 0x000a3400, 0x000a3501, 0x000a3700, 0x000a3801, 0x000a3a00, 0x000a3c0a, 0x000a3d00,
+    0x000a3e0a, 0x000a4300, 0x000a470a, 0x000a4900, 0x000a4b0a, 0x000a4e00, 0x000a510a, 0x000a5200,
+    0x000a5901, 0x000a5d00, 0x000a5e01, 0x000a5f00, 0x000a6602, 0x000a700a, 0x000a7201, 0x000a750a,
+    0x000a7600, 0x000a810a, 0x000a8400, 0x000a8501, 0x000a8e00, 0x000a8f01, 0x000a9200, 0x000a9301,
+    0x000aa900, 0x000aaa01, 0x000ab100, 0x000ab201, 0x000ab400, 0x000ab501, 0x000aba00, 0x000abc0a,
+    0x000abd01, 0x000abe0a, 0x000ac600, 0x000ac70a, 0x000aca00, 0x000acb0a, 0x000ace00, 0x000ad001,
+    0x000ad100, 0x000ae001, 0x000ae20a, 0x000ae400, 0x000ae602, 0x000af000, 0x000af901, 0x000afa0a,
+    0x000b0000, 0x000b010a, 0x000b0400, 0x000b0501, 0x000b0d00, 0x000b0f01, 0x000b1100, 0x000b1301,
+    0x000b2900, 0x000b2a01, 0x000b3100, 0x000b3201, 0x000b3400, 0x000b3501, 0x000b3a00, 0x000b3c0a,
+    0x000b3d01, 0x000b3e0a, 0x000b4500, 0x000b470a, 0x000b4900, 0x000b4b0a, 0x000b4e00, 0x000b550a,
+    0x000b5800, 0x000b5c01, 0x000b5e00, 0x000b5f01, 0x000b620a, 0x000b6400, 0x000b6602, 0x000b7000,
+    0x000b7101, 0x000b7200, 0x000b820a, 0x000b8301, 0x000b8400, 0x000b8501, 0x000b8b00, 0x000b8e01,
+    0x000b9100, 0x000b9201, 0x000b9600, 0x000b9901, 0x000b9b00, 0x000b9c01, 0x000b9d00, 0x000b9e01,
+    0x000ba000, 0x000ba301, 0x000ba500, 0x000ba801, 0x000bab00, 0x000bae01, 0x000bba00, 0x000bbe0a,
+    0x000bc300, 0x000bc60a, 0x000bc900, 0x000bca0a, 0x000bce00, 0x000bd001, 0x000bd100, 0x000bd70a,
+    0x000bd800, 0x000be602, 0x000bf000, 0x000c000a, 0x000c0501, 0x000c0d00, 0x000c0e01, 0x000c1100,
+    0x000c1201, 0x000c2900, 0x000c2a01, 0x000c3a00, 0x000c3c0a, 0x000c3d01, 0x000c3e0a, 0x000c4500,
+    0x000c460a, 0x000c4900, 0x000c4a0a, 0x000c4e00, 0x000c550a, 0x000c5700, 0x000c5801, 0x000c5b00,
+    0x000c5d01, 0x000c5e00, 0x000c6001, 0x000c620a, 0x000c6400, 0x000c6602, 0x000c7000, 0x000c8001,
+    0x000c810a, 0x000c8400, 0x000c8501, 0x000c8d00, 0x000c8e01, 0x000c9100, 0x000c9201, 0x000ca900,
+    0x000caa01, 0x000cb400, 0x000cb501, 0x000cba00, 0x000cbc0a, 0x000cbd01, 0x000cbe0a, 0x000cc500,
+    0x000cc60a, 0x000cc900, 0x000cca0a, 0x000cce00, 0x000cd50a, 0x000cd700, 0x000cdd01, 0x000cdf00,
+    0x000ce001, 0x000ce20a, 0x000ce400, 0x000ce602, 0x000cf000, 0x000cf101, 0x000cf300, 0x000d000a,
+    0x000d0401, 0x000d0d00, 0x000d0e01, 0x000d1100, 0x000d1201, 0x000d3b0a, 0x000d3d01, 0x000d3e0a,
+    0x000d4500, 0x000d460a, 0x000d4900, 0x000d4a0a, 0x000d4e01, 0x000d4f00, 0x000d5401, 0x000d570a,
+    0x000d5800, 0x000d5f01, 0x000d620a, 0x000d6400, 0x000d6602, 0x000d7000, 0x000d7a01, 0x000d8000,
+    0x000d810a, 0x000d8400, 0x000d8501, 0x000d9700, 0x000d9a01, 0x000db200, 0x000db301, 0x000dbc00,
+    0x000dbd01, 0x000dbe00, 0x000dc001, 0x000dc700, 0x000dca0a, 0x000dcb00, 0x000dcf0a, 0x000dd500,
+    0x000dd60a, 0x000dd700, 0x000dd80a, 0x000de000, 0x000de602, 0x000df000, 0x000df20a, 0x000df400,
+    0x000e0101, 0x000e310a, 0x000e3201, 0x000e340a, 0x000e3b00, 0x000e4001, 0x000e470a, 0x000e4f00,
+    0x000e5002, 0x000e5a00, 0x000e8101, 0x000e8300, 0x000e8401, 0x000e8500, 0x000e8601, 0x000e8b00,
+    0x000e8c01, 0x000ea400, 0x000ea501, 0x000ea600, 0x000ea701, 0x000eb10a, 0x000eb201, 0x000eb40a,
+    0x000ebd01, 0x000ebe00, 0x000ec001, 0x000ec500, 0x000ec601, 0x000ec700, 0x000ec80a, 0x000ece00,
+    0x000ed002, 0x000eda00, 0x000edc01, 0x000ee000, 0x000f0001, 0x000f0100, 0x000f180a, 0x000f1a00,
+    0x000f2002, 0x000f2a00, 0x000f350a, 0x000f3600, 0x000f370a, 0x000f3800, 0x000f390a, 0x000f3a00,
+    0x000f3e0a, 0x000f4001, 0x000f4800, 0x000f4901, 0x000f6d00, 0x000f710a, 0x000f8500, 0x000f860a,
+    0x000f8801, 0x000f8d0a, 0x000f9800, 0x000f990a, 0x000fbd00, 0x000fc60a, 0x000fc700, 0x00100001,
+    0x00102b0a, 0x00103f01, 0x00104002, 0x00104a00, 0x00105001, 0x0010560a, 0x00105a01, 0x00105e0a,
+    0x00106101, 0x0010620a, 0x00106501, 0x0010670a, 0x00106e01, 0x0010710a, 0x00107501, 0x0010820a,
+    0x00108e01, 0x00108f0a, 0x00109002, 0x00109a0a, 0x00109e00, 0x0010a001, 0x0010c600, 0x0010c701,
+    0x0010c800, 0x0010cd01, 0x0010ce00, 0x0010d001, 0x0010fb00, 0x0010fc01, 0x00124900, 0x00124a01,
+    0x00124e00, 0x00125001, 0x00125700, 0x00125801, 0x00125900, 0x00125a01, 0x00125e00, 0x00126001,
+    0x00128900, 0x00128a01, 0x00128e00, 0x00129001, 0x0012b100, 0x0012b201, 0x0012b600, 0x0012b801,
+    0x0012bf00, 0x0012c001, 0x0012c100, 0x0012c201, 0x0012c600, 0x0012c801, 0x0012d700, 0x0012d801,
+    0x00131100, 0x00131201, 0x00131600, 0x00131801, 0x00135b00, 0x00135d0a, 0x00136000, 0x00138001,
+    0x00139000, 0x0013a001, 0x0013f600, 0x0013f801, 0x0013fe00, 0x00140101, 0x00166d00, 0x00166f01,
+    0x00168000, 0x00168101, 0x00169b00, 0x0016a001, 0x0016eb00, 0x0016ee01, 0x0016f900, 0x00170001,
+    0x0017120a, 0x00171600, 0x00171f01, 0x0017320a, 0x00173500, 0x00174001, 0x0017520a, 0x00175400,
+    0x00176001, 0x00176d00, 0x00176e01, 0x00177100, 0x0017720a, 0x00177400, 0x00178001, 0x0017b40a,
+    0x0017d400, 0x0017d701, 0x0017d800, 0x0017dc01, 0x0017dd0a, 0x0017de00, 0x0017e002, 0x0017ea00,
+    0x00180b0a, 0x00181002, 0x00181a00, 0x00182001, 0x00187900, 0x00188001, 0x0018850a, 0x00188701,
+    0x0018a90a, 0x0018aa01, 0x0018ab00, 0x0018b001, 0x0018f600, 0x00190001, 0x00191f00, 0x0019200a,
+    0x00192c00, 0x0019300a, 0x00193c00, 0x00194602, 0x00195001, 0x00196e00, 0x00197001, 0x00197500,
+    0x00198001, 0x0019ac00, 0x0019b001, 0x0019ca00, 0x0019d002, 0x0019da00, 0x001a0001, 0x001a170a,
+    0x001a1c00, 0x001a2001, 0x001a550a, 0x001a5f00, 0x001a600a, 0x001a7d00, 0x001a7f0a, 0x001a8002,
+    0x001a8a00, 0x001a9002, 0x001a9a00, 0x001aa701, 0x001aa800, 0x001ab00a, 0x001acf00, 0x001b000a,
+    0x001b0501, 0x001b340a, 0x001b4501, 0x001b4d00, 0x001b5002, 0x001b5a00, 0x001b6b0a, 0x001b7400,
+    0x001b800a, 0x001b8301, 0x001ba10a, 0x001bae01, 0x001bb002, 0x001bba01, 0x001be60a, 0x001bf400,
+    0x001c0001, 0x001c240a, 0x001c3800, 0x001c4002, 0x001c4a00, 0x001c4d01, 0x001c5002, 0x001c5a01,
+    0x001c7e00, 0x001c8001, 0x001c8900, 0x001c9001, 0x001cbb00, 0x001cbd01, 0x001cc000, 0x001cd00a,
+    0x001cd300, 0x001cd40a, 0x001ce901, 0x001ced0a, 0x001cee01, 0x001cf40a, 0x001cf501, 0x001cf70a,
+    0x001cfa01, 0x001cfb00, 0x001d0001, 0x001dc00a, 0x001e0001, 0x001f1600, 0x001f1801, 0x001f1e00,
+    0x001f2001, 0x001f4600, 0x001f4801, 0x001f4e00, 0x001f5001, 0x001f5800, 0x001f5901, 0x001f5a00,
+    0x001f5b01, 0x001f5c00, 0x001f5d01, 0x001f5e00, 0x001f5f01, 0x001f7e00, 0x001f8001, 0x001fb500,
+    0x001fb601, 0x001fbd00, 0x001fbe01, 0x001fbf00, 0x001fc201, 0x001fc500, 0x001fc601, 0x001fcd00,
+    0x001fd001, 0x001fd400, 0x001fd601, 0x001fdc00, 0x001fe001, 0x001fed00, 0x001ff201, 0x001ff500,
+    0x001ff601, 0x001ffd00, 0x00200b0a, 0x00201000, 0x00201807, 0x00201a00, 0x00202407, 0x00202500,
+    0x00202705, 0x00202800, 0x00202a0a, 0x00202f09, 0x00203000, 0x00203f09, 0x00204100, 0x00204406,
+    0x00204500, 0x00205409, 0x00205500, 0x0020600a, 0x00206500, 0x0020660a, 0x00207000, 0x00207101,
+    0x00207200, 0x00207f01, 0x00208000, 0x00209001, 0x00209d00, 0x0020d00a, 0x0020f100, 0x00210201,
+    0x00210300, 0x00210701, 0x00210800, 0x00210a01, 0x00211400, 0x00211501, 0x00211600, 0x00211901,
+    0x00211e00, 0x00212401, 0x00212500, 0x00212601, 0x00212700, 0x00212801, 0x00212900, 0x00212a01,
+    0x00212e00, 0x00212f01, 0x00213a00, 0x00213c01, 0x00214000, 0x00214501, 0x00214a00, 0x00214e01,
+    0x00214f00, 0x00216001, 0x00218900, 0x002c0001, 0x002ce500, 0x002ceb01, 0x002cef0a, 0x002cf201,
+    0x002cf400, 0x002d0001, 0x002d2600, 0x002d2701, 0x002d2800, 0x002d2d01, 0x002d2e00, 0x002d3001,
+    0x002d6800, 0x002d6f01, 0x002d7000, 0x002d7f0a, 0x002d8001, 0x002d9700, 0x002da001, 0x002da700,
+    0x002da801, 0x002daf00, 0x002db001, 0x002db700, 0x002db801, 0x002dbf00, 0x002dc001, 0x002dc700,
+    0x002dc801, 0x002dcf00, 0x002dd001, 0x002dd700, 0x002dd801, 0x002ddf00, 0x002de00a, 0x002e0000,
+    0x002e2f01, 0x002e3000, 0x00300504, 0x00300800, 0x00302101, 0x00302a0a, 0x00303000, 0x00303103,
+    0x00303600, 0x00303801, 0x00303d00, 0x00304104, 0x00309700, 0x0030990a, 0x00309b03, 0x00309d04,
+    0x0030a003, 0x0030fb00, 0x0030fc03, 0x00310000, 0x00310501, 0x00313000, 0x00313101, 0x00318f00,
+    0x0031a001, 0x0031c000, 0x0031f003, 0x00320000, 0x0032d003, 0x0032ff00, 0x00330003, 0x00335800,
+    0x00340004, 0x004dc000, 0x004e0004, 0x00a00001, 0x00a48d00, 0x00a4d001, 0x00a4fe00, 0x00a50001,
+    0x00a60d00, 0x00a61001, 0x00a62002, 0x00a62a01, 0x00a62c00, 0x00a64001, 0x00a66f0a, 0x00a67300,
+    0x00a6740a, 0x00a67e00, 0x00a67f01, 0x00a69e0a, 0x00a6a001, 0x00a6f00a, 0x00a6f200, 0x00a71701,
+    0x00a72000, 0x00a72201, 0x00a78900, 0x00a78b01, 0x00a7cb00, 0x00a7d001, 0x00a7d200, 0x00a7d301,
+    0x00a7d400, 0x00a7d501, 0x00a7da00, 0x00a7f201, 0x00a8020a, 0x00a80301, 0x00a8060a, 0x00a80701,
+    0x00a80b0a, 0x00a80c01, 0x00a8230a, 0x00a82800, 0x00a82c0a, 0x00a82d00, 0x00a84001, 0x00a87400,
+    0x00a8800a, 0x00a88201, 0x00a8b40a, 0x00a8c600, 0x00a8d002, 0x00a8da00, 0x00a8e00a, 0x00a8f201,
+    0x00a8f800, 0x00a8fb01, 0x00a8fc00, 0x00a8fd01, 0x00a8ff0a, 0x00a90002, 0x00a90a01, 0x00a9260a,
+    0x00a92e00, 0x00a93001, 0x00a9470a, 0x00a95400, 0x00a96001, 0x00a97d00, 0x00a9800a, 0x00a98401,
+    0x00a9b30a, 0x00a9c100, 0x00a9cf01, 0x00a9d002, 0x00a9da00, 0x00a9e001, 0x00a9e50a, 0x00a9e601,
+    0x00a9f002, 0x00a9fa01, 0x00a9ff00, 0x00aa0001, 0x00aa290a, 0x00aa3700, 0x00aa4001, 0x00aa430a,
+    0x00aa4401, 0x00aa4c0a, 0x00aa4e00, 0x00aa5002, 0x00aa5a00, 0x00aa6001, 0x00aa7700, 0x00aa7a01,
+    0x00aa7b0a, 0x00aa7e01, 0x00aab00a, 0x00aab101, 0x00aab20a, 0x00aab501, 0x00aab70a, 0x00aab901,
+    0x00aabe0a, 0x00aac001, 0x00aac10a, 0x00aac201, 0x00aac300, 0x00aadb01, 0x00aade00, 0x00aae001,
+    0x00aaeb0a, 0x00aaf000, 0x00aaf201, 0x00aaf50a, 0x00aaf700, 0x00ab0101, 0x00ab0700, 0x00ab0901,
+    0x00ab0f00, 0x00ab1101, 0x00ab1700, 0x00ab2001, 0x00ab2700, 0x00ab2801, 0x00ab2f00, 0x00ab3001,
+    0x00ab5b00, 0x00ab5c01, 0x00ab6a00, 0x00ab7001, 0x00abe30a, 0x00abeb00, 0x00abec0a, 0x00abee00,
+    0x00abf002, 0x00abfa00, 0x00ac0001, 0x00d7a400, 0x00d7b001, 0x00d7c700, 0x00d7cb01, 0x00d7fc00,
+    0x00f90004, 0x00fa6e00, 0x00fa7004, 0x00fada00, 0x00fb0001, 0x00fb0700, 0x00fb1301, 0x00fb1800,
+    0x00fb1d01, 0x00fb1e0a, 0x00fb1f01, 0x00fb2900, 0x00fb2a01, 0x00fb3700, 0x00fb3801, 0x00fb3d00,
+    0x00fb3e01, 0x00fb3f00, 0x00fb4001, 0x00fb4200, 0x00fb4301, 0x00fb4500, 0x00fb4601, 0x00fbb200,
+    0x00fbd301, 0x00fd3e00, 0x00fd5001, 0x00fd9000, 0x00fd9201, 0x00fdc800, 0x00fdf001, 0x00fdfc00,
+    0x00fe000a, 0x00fe1006, 0x00fe1100, 0x00fe1305, 0x00fe1406, 0x00fe1500, 0x00fe200a, 0x00fe3000,
+    0x00fe3309, 0x00fe3500, 0x00fe4d09, 0x00fe5006, 0x00fe5100, 0x00fe5207, 0x00fe5300, 0x00fe5406,
+    0x00fe5505, 0x00fe5600, 0x00fe7001, 0x00fe7500, 0x00fe7601, 0x00fefd00, 0x00feff0a, 0x00ff0000,
+    0x00ff0707, 0x00ff0800, 0x00ff0c06, 0x00ff0d00, 0x00ff0e07, 0x00ff0f00, 0x00ff1002, 0x00ff1a05,
+    0x00ff1b06, 0x00ff1c00, 0x00ff2101, 0x00ff3b00, 0x00ff3f09, 0x00ff4000, 0x00ff4101, 0x00ff5b00,
+    0x00ff6603, 0x00ff9e01, 0x00ffbf00, 0x00ffc201, 0x00ffc800, 0x00ffca01, 0x00ffd000, 0x00ffd201,
+    0x00ffd800, 0x00ffda01, 0x00ffdd00, 0x00fff90a, 0x00fffc00, 0x01000001, 0x01000c00, 0x01000d01,
+    0x01002700, 0x01002801, 0x01003b00, 0x01003c01, 0x01003e00, 0x01003f01, 0x01004e00, 0x01005001,
+    0x01005e00, 0x01008001, 0x0100fb00, 0x01014001, 0x01017500, 0x0101fd0a, 0x0101fe00, 0x01028001,
+    0x01029d00, 0x0102a001, 0x0102d100, 0x0102e00a, 0x0102e100, 0x01030001, 0x01032000, 0x01032d01,
+    0x01034b00, 0x01035001, 0x0103760a, 0x01037b00, 0x01038001, 0x01039e00, 0x0103a001, 0x0103c400,
+    0x0103c801, 0x0103d000, 0x0103d101, 0x0103d600, 0x01040001, 0x01049e00, 0x0104a002, 0x0104aa00,
+    0x0104b001, 0x0104d400, 0x0104d801, 0x0104fc00, 0x01050001, 0x01052800, 0x01053001, 0x01056400,
+    0x01057001, 0x01057b00, 0x01057c01, 0x01058b00, 0x01058c01, 0x01059300, 0x01059401, 0x01059600,
+    0x01059701, 0x0105a200, 0x0105a301, 0x0105b200, 0x0105b301, 0x0105ba00, 0x0105bb01, 0x0105bd00,
+    0x01060001, 0x01073700, 0x01074001, 0x01075600, 0x01076001, 0x01076800, 0x01078001, 0x01078600,
+    0x01078701, 0x0107b100, 0x0107b201, 0x0107bb00, 0x01080001, 0x01080600, 0x01080801, 0x01080900,
+    0x01080a01, 0x01083600, 0x01083701, 0x01083900, 0x01083c01, 0x01083d00, 0x01083f01, 0x01085600,
+    0x01086001, 0x01087700, 0x01088001, 0x01089f00, 0x0108e001, 0x0108f300, 0x0108f401, 0x0108f600,
+    0x01090001, 0x01091600, 0x01092001, 0x01093a00, 0x01098001, 0x0109b800, 0x0109be01, 0x0109c000,
+    0x010a0001, 0x010a010a, 0x010a0400, 0x010a050a, 0x010a0700, 0x010a0c0a, 0x010a1001, 0x010a1400,
+    0x010a1501, 0x010a1800, 0x010a1901, 0x010a3600, 0x010a380a, 0x010a3b00, 0x010a3f0a, 0x010a4000,
+    0x010a6001, 0x010a7d00, 0x010a8001, 0x010a9d00, 0x010ac001, 0x010ac800, 0x010ac901, 0x010ae50a,
+    0x010ae700, 0x010b0001, 0x010b3600, 0x010b4001, 0x010b5600, 0x010b6001, 0x010b7300, 0x010b8001,
+    0x010b9200, 0x010c0001, 0x010c4900, 0x010c8001, 0x010cb300, 0x010cc001, 0x010cf300, 0x010d0001,
+    0x010d240a, 0x010d2800, 0x010d3002, 0x010d3a00, 0x010e8001, 0x010eaa00, 0x010eab0a, 0x010ead00,
+    0x010eb001, 0x010eb200, 0x010f0001, 0x010f1d00, 0x010f2701, 0x010f2800, 0x010f3001, 0x010f460a,
+    0x010f5100, 0x010f7001, 0x010f820a, 0x010f8600, 0x010fb001, 0x010fc500, 0x010fe001, 0x010ff700,
+    0x0110000a, 0x01100301, 0x0110380a, 0x01104700, 0x01106602, 0x0110700a, 0x01107101, 0x0110730a,
+    0x01107501, 0x01107600, 0x01107f0a, 0x01108301, 0x0110b00a, 0x0110bb00, 0x0110bd0a, 0x0110be00,
+    0x0110c20a, 0x0110c300, 0x0110cd0a, 0x0110ce00, 0x0110d001, 0x0110e900, 0x0110f002, 0x0110fa00,
+    0x0111000a, 0x01110301, 0x0111270a, 0x01113500, 0x01113602, 0x01114000, 0x01114401, 0x0111450a,
+    0x01114701, 0x01114800, 0x01115001, 0x0111730a, 0x01117400, 0x01117601, 0x01117700, 0x0111800a,
+    0x01118301, 0x0111b30a, 0x0111c101, 0x0111c500, 0x0111c90a, 0x0111cd00, 0x0111ce0a, 0x0111d002,
+    0x0111da01, 0x0111db00, 0x0111dc01, 0x0111dd00, 0x01120001, 0x01121200, 0x01121301, 0x01122c0a,
+    0x01123800, 0x01123e0a, 0x01123f00, 0x01128001, 0x01128700, 0x01128801, 0x01128900, 0x01128a01,
+    0x01128e00, 0x01128f01, 0x01129e00, 0x01129f01, 0x0112a900, 0x0112b001, 0x0112df0a, 0x0112eb00,
+    0x0112f002, 0x0112fa00, 0x0113000a, 0x01130400, 0x01130501, 0x01130d00, 0x01130f01, 0x01131100,
+    0x01131301, 0x01132900, 0x01132a01, 0x01133100, 0x01133201, 0x01133400, 0x01133501, 0x01133a00,
+    0x01133b0a, 0x01133d01, 0x01133e0a, 0x01134500, 0x0113470a, 0x01134900, 0x01134b0a, 0x01134e00,
+    0x01135001, 0x01135100, 0x0113570a, 0x01135800, 0x01135d01, 0x0113620a, 0x01136400, 0x0113660a,
+    0x01136d00, 0x0113700a, 0x01137500, 0x01140001, 0x0114350a, 0x01144701, 0x01144b00, 0x01145002,
+    0x01145a00, 0x01145e0a, 0x01145f01, 0x01146200, 0x01148001, 0x0114b00a, 0x0114c401, 0x0114c600,
+    0x0114c701, 0x0114c800, 0x0114d002, 0x0114da00, 0x01158001, 0x0115af0a, 0x0115b600, 0x0115b80a,
+    0x0115c100, 0x0115d801, 0x0115dc0a, 0x0115de00, 0x01160001, 0x0116300a, 0x01164100, 0x01164401,
+    0x01164500, 0x01165002, 0x01165a00, 0x01168001, 0x0116ab0a, 0x0116b801, 0x0116b900, 0x0116c002,
+    0x0116ca00, 0x01170001, 0x01171b00, 0x01171d0a, 0x01172c00, 0x01173002, 0x01173a00, 0x01174001,
+    0x01174700, 0x01180001, 0x01182c0a, 0x01183b00, 0x0118a001, 0x0118e002, 0x0118ea00, 0x0118ff01,
+    0x01190700, 0x01190901, 0x01190a00, 0x01190c01, 0x01191400, 0x01191501, 0x01191700, 0x01191801,
+    0x0119300a, 0x01193600, 0x0119370a, 0x01193900, 0x01193b0a, 0x01193f01, 0x0119400a, 0x01194101,
+    0x0119420a, 0x01194400, 0x01195002, 0x01195a00, 0x0119a001, 0x0119a800, 0x0119aa01, 0x0119d10a,
+    0x0119d800, 0x0119da0a, 0x0119e101, 0x0119e200, 0x0119e301, 0x0119e40a, 0x0119e500, 0x011a0001,
+    0x011a010a, 0x011a0b01, 0x011a330a, 0x011a3a01, 0x011a3b0a, 0x011a3f00, 0x011a470a, 0x011a4800,
+    0x011a5001, 0x011a510a, 0x011a5c01, 0x011a8a0a, 0x011a9a00, 0x011a9d01, 0x011a9e00, 0x011ab001,
+    0x011af900, 0x011c0001, 0x011c0900, 0x011c0a01, 0x011c2f0a, 0x011c3700, 0x011c380a, 0x011c4001,
+    0x011c4100, 0x011c5002, 0x011c5a00, 0x011c7201, 0x011c9000, 0x011c920a, 0x011ca800, 0x011ca90a,
+    0x011cb700, 0x011d0001, 0x011d0700, 0x011d0801, 0x011d0a00, 0x011d0b01, 0x011d310a, 0x011d3700,
+    0x011d3a0a, 0x011d3b00, 0x011d3c0a, 0x011d3e00, 0x011d3f0a, 0x011d4601, 0x011d470a, 0x011d4800,
+    0x011d5002, 0x011d5a00, 0x011d6001, 0x011d6600, 0x011d6701, 0x011d6900, 0x011d6a01, 0x011d8a0a,
+    0x011d8f00, 0x011d900a, 0x011d9200, 0x011d930a, 0x011d9801, 0x011d9900, 0x011da002, 0x011daa00,
+    0x011ee001, 0x011ef30a, 0x011ef700, 0x011fb001, 0x011fb100, 0x01200001, 0x01239a00, 0x01240001,
+    0x01246f00, 0x01248001, 0x01254400, 0x012f9001, 0x012ff100, 0x01300001, 0x01342f00, 0x0134300a,
+    0x01343900, 0x01440001, 0x01464700, 0x01680001, 0x016a3900, 0x016a4001, 0x016a5f00, 0x016a6002,
+    0x016a6a00, 0x016a7001, 0x016abf00, 0x016ac002, 0x016aca00, 0x016ad001, 0x016aee00, 0x016af00a,
+    0x016af500, 0x016b0001, 0x016b300a, 0x016b3700, 0x016b4001, 0x016b4400, 0x016b5002, 0x016b5a00,
+    0x016b6301, 0x016b7800, 0x016b7d01, 0x016b9000, 0x016e4001, 0x016e8000, 0x016f0001, 0x016f4b00,
+    0x016f4f0a, 0x016f5001, 0x016f510a, 0x016f8800, 0x016f8f0a, 0x016f9301, 0x016fa000, 0x016fe001,
+    0x016fe200, 0x016fe301, 0x016fe40a, 0x016fe500, 0x016ff00a, 0x016ff200, 0x01700001, 0x0187f800,
+    0x01880001, 0x018cd600, 0x018d0001, 0x018d0900, 0x01aff001, 0x01aff400, 0x01aff501, 0x01affc00,
+    0x01affd01, 0x01afff00, 0x01b00003, 0x01b00101, 0x01b12300, 0x01b15001, 0x01b15300, 0x01b16401,
+    0x01b16800, 0x01b17001, 0x01b2fc00, 0x01bc0001, 0x01bc6b00, 0x01bc7001, 0x01bc7d00, 0x01bc8001,
+    0x01bc8900, 0x01bc9001, 0x01bc9a00, 0x01bc9d0a, 0x01bc9f00, 0x01bca00a, 0x01bca400, 0x01cf000a,
+    0x01cf2e00, 0x01cf300a, 0x01cf4700, 0x01d1650a, 0x01d16a00, 0x01d16d0a, 0x01d18300, 0x01d1850a,
+    0x01d18c00, 0x01d1aa0a, 0x01d1ae00, 0x01d2420a, 0x01d24500, 0x01d40001, 0x01d45500, 0x01d45601,
+    0x01d49d00, 0x01d49e01, 0x01d4a000, 0x01d4a201, 0x01d4a300, 0x01d4a501, 0x01d4a700, 0x01d4a901,
+    0x01d4ad00, 0x01d4ae01, 0x01d4ba00, 0x01d4bb01, 0x01d4bc00, 0x01d4bd01, 0x01d4c400, 0x01d4c501,
+    0x01d50600, 0x01d50701, 0x01d50b00, 0x01d50d01, 0x01d51500, 0x01d51601, 0x01d51d00, 0x01d51e01,
+    0x01d53a00, 0x01d53b01, 0x01d53f00, 0x01d54001, 0x01d54500, 0x01d54601, 0x01d54700, 0x01d54a01,
+    0x01d55100, 0x01d55201, 0x01d6a600, 0x01d6a801, 0x01d6c100, 0x01d6c201, 0x01d6db00, 0x01d6dc01,
+    0x01d6fb00, 0x01d6fc01, 0x01d71500, 0x01d71601, 0x01d73500, 0x01d73601, 0x01d74f00, 0x01d75001,
+    0x01d76f00, 0x01d77001, 0x01d78900, 0x01d78a01, 0x01d7a900, 0x01d7aa01, 0x01d7c300, 0x01d7c401,
+    0x01d7cc00, 0x01d7ce02, 0x01d80000, 0x01da000a, 0x01da3700, 0x01da3b0a, 0x01da6d00, 0x01da750a,
+    0x01da7600, 0x01da840a, 0x01da8500, 0x01da9b0a, 0x01daa000, 0x01daa10a, 0x01dab000, 0x01df0001,
+    0x01df1f00, 0x01e0000a, 0x01e00700, 0x01e0080a, 0x01e01900, 0x01e01b0a, 0x01e02200, 0x01e0230a,
+    0x01e02500, 0x01e0260a, 0x01e02b00, 0x01e10001, 0x01e12d00, 0x01e1300a, 0x01e13701, 0x01e13e00,
+    0x01e14002, 0x01e14a00, 0x01e14e01, 0x01e14f00, 0x01e29001, 0x01e2ae0a, 0x01e2af00, 0x01e2c001,
+    0x01e2ec0a, 0x01e2f002, 0x01e2fa00, 0x01e7e001, 0x01e7e700, 0x01e7e801, 0x01e7ec00, 0x01e7ed01,
+    0x01e7ef00, 0x01e7f001, 0x01e7ff00, 0x01e80001, 0x01e8c500, 0x01e8d00a, 0x01e8d700, 0x01e90001,
+    0x01e9440a, 0x01e94b01, 0x01e94c00, 0x01e95002, 0x01e95a00, 0x01ee0001, 0x01ee0400, 0x01ee0501,
+    0x01ee2000, 0x01ee2101, 0x01ee2300, 0x01ee2401, 0x01ee2500, 0x01ee2701, 0x01ee2800, 0x01ee2901,
+    0x01ee3300, 0x01ee3401, 0x01ee3800, 0x01ee3901, 0x01ee3a00, 0x01ee3b01, 0x01ee3c00, 0x01ee4201,
+    0x01ee4300, 0x01ee4701, 0x01ee4800, 0x01ee4901, 0x01ee4a00, 0x01ee4b01, 0x01ee4c00, 0x01ee4d01,
+    0x01ee5000, 0x01ee5101, 0x01ee5300, 0x01ee5401, 0x01ee5500, 0x01ee5701, 0x01ee5800, 0x01ee5901,
+    0x01ee5a00, 0x01ee5b01, 0x01ee5c00, 0x01ee5d01, 0x01ee5e00, 0x01ee5f01, 0x01ee6000, 0x01ee6101,
+    0x01ee6300, 0x01ee6401, 0x01ee6500, 0x01ee6701, 0x01ee6b00, 0x01ee6c01, 0x01ee7300, 0x01ee7401,
+    0x01ee7800, 0x01ee7901, 0x01ee7d00, 0x01ee7e01, 0x01ee7f00, 0x01ee8001, 0x01ee8a00, 0x01ee8b01,
+    0x01ee9c00, 0x01eea101, 0x01eea400, 0x01eea501, 0x01eeaa00, 0x01eeab01, 0x01eebc00, 0x01fbf002,
+    0x01fbfa00, 0x02000004, 0x02a6e000, 0x02a70004, 0x02b73900, 0x02b74004, 0x02b81e00, 0x02b82004,
+    0x02cea200, 0x02ceb004, 0x02ebe100, 0x02f80004, 0x02fa1e00, 0x03000004, 0x03134b00, 0x0e00010a,
+    0x0e000200, 0x0e00200a, 0x0e008000, 0x0e01000a, 0x0e01f000,
+};
+
+// Character classes
+
+// Bit flags of CharClass per code point: alpha is L* and Nl, digit is Nd,
+// space is White_Space, punct is P*, upper is Lu and lower is Ll.
+struct CharClass {
+  static constexpr uint8_t alpha = 1 << 0;
+  static constexpr uint8_t digit = 1 << 1;
+  static constexpr uint8_t space = 1 << 2;
+  static constexpr uint8_t punct = 1 << 3;
+  static constexpr uint8_t upper = 1 << 4;
+  static constexpr uint8_t lower = 1 << 5;
+};
+
+// Runs of code points sharing the same CharClass bits, as (first << 8) | bits.
+constexpr std::array<uint32_t, 2885> char_class_runs{
+    0x00000000, 0x00000904, 0x00000e00, 0x00002004, 0x00002108, 0x00002400, 0x00002508, 0x00002b00,
+    0x00002c08, 0x00003002, 0x00003a08, 0x00003c00, 0x00003f08, 0x00004111, 0x00005b08, 0x00005e00,
+    0x00005f08, 0x00006000, 0x00006121, 0x00007b08, 0x00007c00, 0x00007d08, 0x00007e00, 0x00008504,
+    0x00008600, 0x0000a004, 0x0000a108, 0x0000a200, 0x0000a708, 0x0000a800, 0x0000aa01, 0x0000ab08,
+    0x0000ac00, 0x0000b521, 0x0000b608, 0x0000b800, 0x0000ba01, 0x0000bb08, 0x0000bc00, 0x0000bf08,
+    0x0000c011, 0x0000d700, 0x0000d811, 0x0000df21, 0x0000f700, 0x0000f821, 0x00010011, 0x00010121,
+    0x00010211, 0x00010321, 0x00010411, 0x00010521, 0x00010611, 0x00010721, 0x00010811, 0x00010921,
+    0x00010a11, 0x00010b21, 0x00010c11, 0x00010d21, 0x00010e11, 0x00010f21, 0x00011011, 0x00011121,
+    0x00011211, 0x00011321, 0x00011411, 0x00011521, 0x00011611, 0x00011721, 0x00011811, 0x00011921,
+    0x00011a11, 0x00011b21, 0x00011c11, 0x00011d21, 0x00011e11, 0x00011f21, 0x00012011, 0x00012121,
+    0x00012211, 0x00012321, 0x00012411, 0x00012521, 0x00012611, 0x00012721, 0x00012811, 0x00012921,
+    0x00012a11, 0x00012b21, 0x00012c11, 0x00012d21, 0x00012e11, 0x00012f21, 0x00013011, 0x00013121,
+    0x00013211, 0x00013321, 0x00013411, 0x00013521, 0x00013611, 0x00013721, 0x00013911, 0x00013a21,
+    0x00013b11, 0x00013c21, 0x00013d11, 0x00013e21, 0x00013f11, 0x00014021, 0x00014111, 0x00014221,
+    0x00014311, 0x00014421, 0x00014511, 0x00014621, 0x00014711, 0x00014821, 0x00014a11, 0x00014b21,
+    0x00014c11, 0x00014d21, 0x00014e11, 0x00014f21, 0x00015011, 0x00015121, 0x00015211, 0x00015321,
+    0x00015411, 0x00015521, 0x00015611, 0x00015721, 0x00015811, 0x00015921, 0x00015a11, 0x00015b21,
+    0x00015c11, 0x00015d21, 0x00015e11, 0x00015f21, 0x00016011, 0x00016121, 0x00016211, 0x00016321,
+    0x00016411, 0x00016521, 0x00016611, 0x00016721, 0x00016811, 0x00016921, 0x00016a11, 0x00016b21,
+    0x00016c11, 0x00016d21, 0x00016e11, 0x00016f21, 0x00017011, 0x00017121, 0x00017211, 0x00017321,
+    0x00017411, 0x00017521, 0x00017611, 0x00017721, 0x00017811, 0x00017a21, 0x00017b11, 0x00017c21,
+    0x00017d11, 0x00017e21, 0x00018111, 0x00018321, 0x00018411, 0x00018521, 0x00018611, 0x00018821,
+    0x00018911, 0x00018c21, 0x00018e11, 0x00019221, 0x00019311, 0x00019521, 0x00019611, 0x00019921,
+    0x00019c11, 0x00019e21, 0x00019f11, 0x0001a121, 0x0001a211, 0x0001a321, 0x0001a411, 0x0001a521,
+    0x0001a611, 0x0001a821, 0x0001a911, 0x0001aa21, 0x0001ac11, 0x0001ad21, 0x0001ae11, 0x0001b021,
+    0x0001b111, 0x0001b421, 0x0001b511, 0x0001b621, 0x0001b711, 0x0001b921, 0x0001bb01, 0x0001bc11,
+    0x0001bd21, 0x0001c001, 0x0001c411, 0x0001c501, 0x0001c621, 0x0001c711, 0x0001c801, 0x0001c921,
+    0x0001ca11, 0x0001cb01, 0x0001cc21, 0x0001cd11, 0x0001ce21, 0x0001cf11, 0x0001d021, 0x0001d111,
+    0x0001d221, 0x0001d311, 0x0001d421, 0x0001d511, 0x0001d621, 0x0001d711, 0x0001d821, 0x0001d911,
+    0x0001da21, 0x0001db11, 0x0001dc21, 0x0001de11, 0x0001df21, 0x0001e011, 0x0001e121, 0x0001e211,
+    0x0001e321, 0x0001e411, 0x0001e521, 0x0001e611, 0x0001e721, 0x0001e811, 0x0001e921, 0x0001ea11,
+    0x0001eb21, 0x0001ec11, 0x0001ed21, 0x0001ee11, 0x0001ef21, 0x0001f111, 0x0001f201, 0x0001f321,
+    0x0001f411, 0x0001f521, 0x0001f611, 0x0001f921, 0x0001fa11, 0x0001fb21, 0x0001fc11, 0x0001fd21,
+    0x0001fe11, 0x0001ff21, 0x00020011, 0x00020121, 0x00020211, 0x00020321, 0x00020411, 0x00020521,
+    0x00020611, 0x00020721, 0x00020811, 0x00020921, 0x00020a11, 0x00020b21, 0x00020c11, 0x00020d21,
+    0x00020e11, 0x00020f21, 0x00021011, 0x00021121, 0x00021211, 0x00021321, 0x00021411, 0x00021521,
+    0x00021611, 0x00021721, 0x00021811, 0x00021921, 0x00021a11, 0x00021b21, 0x00021c11, 0x00021d21,
+    0x00021e11, 0x00021f21, 0x00022011, 0x00022121, 0x00022211, 0x00022321, 0x00022411, 0x00022521,
+    0x00022611, 0x00022721, 0x00022811, 0x00022921, 0x00022a11, 0x00022b21, 0x00022c11, 0x00022d21,
+    0x00022e11, 0x00022f21, 0x00023011, 0x00023121, 0x00023211, 0x00023321, 0x00023a11, 0x00023c21,
+    0x00023d11, 0x00023f21, 0x00024111, 0x00024221, 0x00024311, 0x00024721, 0x00024811, 0x00024921,
+    0x00024a11, 0x00024b21, 0x00024c11, 0x00024d21, 0x00024e11, 0x00024f21, 0x00029401, 0x00029521,
+    0x0002b001, 0x0002c200, 0x0002c601, 0x0002d200, 0x0002e001, 0x0002e500, 0x0002ec01, 0x0002ed00,
+    0x0002ee01, 0x0002ef00, 0x00037011, 0x00037121, 0x00037211, 0x00037321, 0x00037401, 0x00037500,
+    0x00037611, 0x00037721, 0x00037800, 0x00037a01, 0x00037b21, 0x00037e08, 0x00037f11, 0x00038000,
+    0x00038611, 0x00038708, 0x00038811, 0x00038b00, 0x00038c11, 0x00038d00, 0x00038e11, 0x00039021,
+    0x00039111, 0x0003a200, 0x0003a311, 0x0003ac21, 0x0003cf11, 0x0003d021, 0x0003d211, 0x0003d521,
+    0x0003d811, 0x0003d921, 0x0003da11, 0x0003db21, 0x0003dc11, 0x0003dd21, 0x0003de11, 0x0003df21,
+    0x0003e011, 0x0003e121, 0x0003e211, 0x0003e321, 0x0003e411, 0x0003e521, 0x0003e611, 0x0003e721,
+    0x0003e811, 0x0003e921, 0x0003ea11, 0x0003eb21, 0x0003ec11, 0x0003ed21, 0x0003ee11, 0x0003ef21,
+    0x0003f411, 0x0003f521, 0x0003f600, 0x0003f711, 0x0003f821, 0x0003f911, 0x0003fb21, 0x0003fd11,
+    0x00043021, 0x00046011, 0x00046121, 0x00046211, 0x00046321, 0x00046411, 0x00046521, 0x00046611,
+    0x00046721, 0x00046811, 0x00046921, 0x00046a11, 0x00046b21, 0x00046c11, 0x00046d21, 0x00046e11,
+    0x00046f21, 0x00047011, 0x00047121, 0x00047211, 0x00047321, 0x00047411, 0x00047521, 0x00047611,
+    0x00047721, 0x00047811, 0x00047921, 0x00047a11, 0x00047b21, 0x00047c11, 0x00047d21, 0x00047e11,
+    0x00047f21, 0x00048011, 0x00048121, 0x00048200, 0x00048a11, 0x00048b21, 0x00048c11, 0x00048d21,
+    0x00048e11, 0x00048f21, 0x00049011, 0x00049121, 0x00049211, 0x00049321, 0x00049411, 0x00049521,
+    0x00049611, 0x00049721, 0x00049811, 0x00049921, 0x00049a11, 0x00049b21, 0x00049c11, 0x00049d21,
+    0x00049e11, 0x00049f21, 0x0004a011, 0x0004a121, 0x0004a211, 0x0004a321, 0x0004a411, 0x0004a521,
+    0x0004a611, 0x0004a721, 0x0004a811, 0x0004a921, 0x0004aa11, 0x0004ab21, 0x0004ac11, 0x0004ad21,
+    0x0004ae11, 0x0004af21, 0x0004b011, 0x0004b121, 0x0004b211, 0x0004b321, 0x0004b411, 0x0004b521,
+    0x0004b611, 0x0004b721, 0x0004b811, 0x0004b921, 0x0004ba11, 0x0004bb21, 0x0004bc11, 0x0004bd21,
+    0x0004be11, 0x0004bf21, 0x0004c011, 0x0004c221, 0x0004c311, 0x0004c421, 0x0004c511, 0x0004c621,
+    0x0004c711, 0x0004c821, 0x0004c911, 0x0004ca21, 0x0004cb11, 0x0004cc21, 0x0004cd11, 0x0004ce21,
+    0x0004d011, 0x0004d121, 0x0004d211, 0x0004d321, 0x0004d411, 0x0004d521, 0x0004d611, 0x0004d721,
+    0x0004d811, 0x0004d921, 0x0004da11, 0x0004db21, 0x0004dc11, 0x0004dd21, 0x0004de11, 0x0004df21,
+    0x0004e011, 0x0004e121, 0x0004e211, 0x0004e321, 0x0004e411, 0x0004e521, 0x0004e611, 0x0004e721,
+    0x0004e811, 0x0004e921, 0x0004ea11, 0x0004eb21, 0x0004ec11, 0x0004ed21, 0x0004ee11, 0x0004ef21,
+    0x0004f011, 0x0004f121, 0x0004f211, 0x0004f321, 0x0004f411, 0x0004f521, 0x0004f611, 0x0004f721,
+    0x0004f811, 0x0004f921, 0x0004fa11, 0x0004fb21, 0x0004fc11, 0x0004fd21, 0x0004fe11, 0x0004ff21,
+    0x00050011, 0x00050121, 0x00050211, 0x00050321, 0x00050411, 0x00050521, 0x00050611, 0x00050721,
+    0x00050811, 0x00050921, 0x00050a11, 0x00050b21, 0x00050c11, 0x00050d21, 0x00050e11, 0x00050f21,
+    0x00051011, 0x00051121, 0x00051211, 0x00051321, 0x00051411, 0x00051521, 0x00051611, 0x00051721,
+    0x00051811, 0x00051921, 0x00051a11, 0x00051b21, 0x00051c11, 0x00051d21, 0x00051e11, 0x00051f21,
+    0x00052011, 0x00052121, 0x00052211, 0x00052321, 0x00052411, 0x00052521, 0x00052611, 0x00052721,
+    0x00052811, 0x00052921, 0x00052a11, 0x00052b21, 0x00052c11, 0x00052d21, 0x00052e11, 0x00052f21,
+    0x00053000, 0x00053111, 0x00055700, 0x00055901, 0x00055a08, 0x00056021, 0x00058908, 0x00058b00,
+    0x0005be08, 0x0005bf00, 0x0005c008, 0x0005c100, 0x0005c308, 0x0005c400, 0x0005c608, 0x0005c700,
+    0x0005d001, 0x0005eb00, 0x0005ef01, 0x0005f308, 0x0005f500, 0x00060908, 0x00060b00, 0x00060c08,
+    0x00060e00, 0x00061b08, 0x00061c00, 0x00061d08, 0x00062001, 0x00064b00, 0x00066002, 0x00066a08,
+    0x00066e01, 0x00067000, 0x00067101, 0x0006d408, 0x0006d501, 0x0006d600, 0x0006e501, 0x0006e700,
+    0x0006ee01, 0x0006f002, 0x0006fa01, 0x0006fd00, 0x0006ff01, 0x00070008, 0x00070e00, 0x00071001,
+    0x00071100, 0x00071201, 0x00073000, 0x00074d01, 0x0007a600, 0x0007b101, 0x0007b200, 0x0007c002,
+    0x0007ca01, 0x0007eb00, 0x0007f401, 0x0007f600, 0x0007f708, 0x0007fa01, 0x0007fb00, 0x00080001,
+    0x00081600, 0x00081a01, 0x00081b00, 0x00082401, 0x00082500, 0x00082801, 0x00082900, 0x00083008,
+    0x00083f00, 0x00084001, 0x00085900, 0x00085e08, 0x00085f00, 0x00086001, 0x00086b00, 0x00087001,
+    0x00088800, 0x00088901, 0x00088f00, 0x0008a001, 0x0008ca00, 0x00090401, 0x00093a00, 0x00093d01,
+    0x00093e00, 0x00095001, 0x00095100, 0x00095801, 0x00096200, 0x00096408, 0x00096602, 0x00097008,
+    0x00097101, 0x00098100, 0x00098501, 0x00098d00, 0x00098f01, 0x00099100, 0x00099301, 0x0009a900,
+    0x0009aa01, 0x0009b100, 0x0009b201, 0x0009b300, 0x0009b601, 0x0009ba00, 0x0009bd01, 0x0009be00,
+    0x0009ce01, 0x0009cf00, 0x0009dc01, 0x0009de00, 0x0009df01, 0x0009e200, 0x0009e602, 0x0009f001,
+    0x0009f200, 0x0009fc01, 0x0009fd08, 0x0009fe00, 0x000a0501, 0x000a0b00, 0x000a0f01, 0x000a1100,
+    0x000a1301, 0x000a2900, 0x000a2a01, 0x000a3100, 0x000a3201, 0x000a3400, 0x000a3501, 0x000a3700,
+    0x000a3801, 0x000a3a00, 0x000a5901, 0x000a5d00, 0x000a5e01, 0x000a5f00, 0x000a6602, 0x000a7000,
+    0x000a7201, 0x000a7500, 0x000a7608, 0x000a7700, 0x000a8501, 0x000a8e00, 0x000a8f01, 0x000a9200,
+    0x000a9301, 0x000aa900, 0x000aaa01, 0x000ab100, 0x000ab201, 0x000ab400, 0x000ab501, 0x000aba00,
+    0x000abd01, 0x000abe00, 0x000ad001, 0x000ad100, 0x000ae001, 0x000ae200, 0x000ae602, 0x000af008,
+    0x000af100, 0x000af901, 0x000afa00, 0x000b0501, 0x000b0d00, 0x000b0f01, 0x000b1100, 0x000b1301,
+    0x000b2900, 0x000b2a01, 0x000b3100, 0x000b3201, 0x000b3400, 0x000b3501, 0x000b3a00, 0x000b3d01,
+    0x000b3e00, 0x000b5c01, 0x000b5e00, 0x000b5f01, 0x000b6200, 0x000b6602, 0x000b7000, 0x000b7101,
+    0x000b7200, 0x000b8301, 0x000b8400, 0x000b8501, 0x000b8b00, 0x000b8e01, 0x000b9100, 0x000b9201,
+    0x000b9600, 0x000b9901, 0x000b9b00, 0x000b9c01, 0x000b9d00, 0x000b9e01, 0x000ba000, 0x000ba301,
+    0x000ba500, 0x000ba801, 0x000bab00, 0x000bae01, 0x000bba00, 0x000bd001, 0x000bd100, 0x000be602,
+    0x000bf000, 0x000c0501, 0x000c0d00, 0x000c0e01, 0x000c1100, 0x000c1201, 0x000c2900, 0x000c2a01,
+    0x000c3a00, 0x000c3d01, 0x000c3e00, 0x000c5801, 0x000c5b00, 0x000c5d01, 0x000c5e00, 0x000c6001,
+    0x000c6200, 0x000c6602, 0x000c7000, 0x000c7708, 0x000c7800, 0x000c8001, 0x000c8100, 0x000c8408,
+    0x000c8501, 0x000c8d00, 0x000c8e01, 0x000c9100, 0x000c9201, 0x000ca900, 0x000caa01, 0x000cb400,
+    0x000cb501, 0x000cba00, 0x000cbd01, 0x000cbe00, 0x000cdd01, 0x000cdf00, 0x000ce001, 0x000ce200,
+    0x000ce602, 0x000cf000, 0x000cf101, 0x000cf300, 0x000d0401, 0x000d0d00, 0x000d0e01, 0x000d1100,
+    0x000d1201, 0x000d3b00, 0x000d3d01, 0x000d3e00, 0x000d4e01, 0x000d4f00, 0x000d5401, 0x000d5700,
+    0x000d5f01, 0x000d6200, 0x000d6602, 0x000d7000, 0x000d7a01, 0x000d8000, 0x000d8501, 0x000d9700,
+    0x000d9a01, 0x000db200, 0x000db301, 0x000dbc00, 0x000dbd01, 0x000dbe00, 0x000dc001, 0x000dc700,
+    0x000de602, 0x000df000, 0x000df408, 0x000df500, 0x000e0101, 0x000e3100, 0x000e3201, 0x000e3400,
+    0x000e4001, 0x000e4700, 0x000e4f08, 0x000e5002, 0x000e5a08, 0x000e5c00, 0x000e8101, 0x000e8300,
+    0x000e8401, 0x000e8500, 0x000e8601, 0x000e8b00, 0x000e8c01, 0x000ea400, 0x000ea501, 0x000ea600,
+    0x000ea701, 0x000eb100, 0x000eb201, 0x000eb400, 0x000ebd01, 0x000ebe00, 0x000ec001, 0x000ec500,
+    0x000ec601, 0x000ec700, 0x000ed002, 0x000eda00, 0x000edc01, 0x000ee000, 0x000f0001, 0x000f0100,
+    0x000f0408, 0x000f1300, 0x000f1408, 0x000f1500, 0x000f2002, 0x000f2a00, 0x000f3a08, 0x000f3e00,
+    0x000f4001, 0x000f4800, 0x000f4901, 0x000f6d00, 0x000f8508, 0x000f8600, 0x000f8801, 0x000f8d00,
+    0x000fd008, 0x000fd500, 0x000fd908, 0x000fdb00, 0x00100001, 0x00102b00, 0x00103f01, 0x00104002,
+    0x00104a08, 0x00105001, 0x00105600, 0x00105a01, 0x00105e00, 0x00106101, 0x00106200, 0x00106501,
+    0x00106700, 0x00106e01, 0x00107100, 0x00107501, 0x00108200, 0x00108e01, 0x00108f00, 0x00109002,
+    0x00109a00, 0x0010a011, 0x0010c600, 0x0010c711, 0x0010c800, 0x0010cd11, 0x0010ce00, 0x0010d021,
+    0x0010fb08, 0x0010fc01, 0x0010fd21, 0x00110001, 0x00124900, 0x00124a01, 0x00124e00, 0x00125001,
+    0x00125700, 0x00125801, 0x00125900, 0x00125a01, 0x00125e00, 0x00126001, 0x00128900, 0x00128a01,
+    0x00128e00, 0x00129001, 0x0012b100, 0x0012b201, 0x0012b600, 0x0012b801, 0x0012bf00, 0x0012c001,
+    0x0012c100, 0x0012c201, 0x0012c600, 0x0012c801, 0x0012d700, 0x0012d801, 0x00131100, 0x00131201,
+    0x00131600, 0x00131801, 0x00135b00, 0x00136008, 0x00136900, 0x00138001, 0x00139000, 0x0013a011,
+    0x0013f600, 0x0013f821, 0x0013fe00, 0x00140008, 0x00140101, 0x00166d00, 0x00166e08, 0x00166f01,
+    0x00168004, 0x00168101, 0x00169b08, 0x00169d00, 0x0016a001, 0x0016eb08, 0x0016ee01, 0x0016f900,
+    0x00170001, 0x00171200, 0x00171f01, 0x00173200, 0x00173508, 0x00173700, 0x00174001, 0x00175200,
+    0x00176001, 0x00176d00, 0x00176e01, 0x00177100, 0x00178001, 0x0017b400, 0x0017d408, 0x0017d701,
+    0x0017d808, 0x0017db00, 0x0017dc01, 0x0017dd00, 0x0017e002, 0x0017ea00, 0x00180008, 0x00180b00,
+    0x00181002, 0x00181a00, 0x00182001, 0x00187900, 0x00188001, 0x00188500, 0x00188701, 0x0018a900,
+    0x0018aa01, 0x0018ab00, 0x0018b001, 0x0018f600, 0x00190001, 0x00191f00, 0x00194408, 0x00194602,
+    0x00195001, 0x00196e00, 0x00197001, 0x00197500, 0x00198001, 0x0019ac00, 0x0019b001, 0x0019ca00,
+    0x0019d002, 0x0019da00, 0x001a0001, 0x001a1700, 0x001a1e08, 0x001a2001, 0x001a5500, 0x001a8002,
+    0x001a8a00, 0x001a9002, 0x001a9a00, 0x001aa008, 0x001aa701, 0x001aa808, 0x001aae00, 0x001b0501,
+    0x001b3400, 0x001b4501, 0x001b4d00, 0x001b5002, 0x001b5a08, 0x001b6100, 0x001b7d08, 0x001b7f00,
+    0x001b8301, 0x001ba100, 0x001bae01, 0x001bb002, 0x001bba01, 0x001be600, 0x001bfc08, 0x001c0001,
+    0x001c2400, 0x001c3b08, 0x001c4002, 0x001c4a00, 0x001c4d01, 0x001c5002, 0x001c5a01, 0x001c7e08,
+    0x001c8021, 0x001c8900, 0x001c9011, 0x001cbb00, 0x001cbd11, 0x001cc008, 0x001cc800, 0x001cd308,
+    0x001cd400, 0x001ce901, 0x001ced00, 0x001cee01, 0x001cf400, 0x001cf501, 0x001cf700, 0x001cfa01,
+    0x001cfb00, 0x001d0021, 0x001d2c01, 0x001d6b21, 0x001d7801, 0x001d7921, 0x001d9b01, 0x001dc000,
+    0x001e0011, 0x001e0121, 0x001e0211, 0x001e0321, 0x001e0411, 0x001e0521, 0x001e0611, 0x001e0721,
+    0x001e0811, 0x001e0921, 0x001e0a11, 0x001e0b21, 0x001e0c11, 0x001e0d21, 0x001e0e11, 0x001e0f21,
+    0x001e1011, 0x001e1121, 0x001e1211, 0x001e1321, 0x001e1411, 0x001e1521, 0x001e1611, 0x001e1721,
+    0x001e1811, 0x001e1921, 0x001e1a11, 0x001e1b21, 0x001e1c11, 0x001e1d21, 0x001e1e11, 0x001e1f21,
+    0x001e2011, 0x001e2121, 0x001e2211, 0x001e2321, 0x001e2411, 0x001e2521, 0x001e2611, 0x001e2721,
+    0x001e2811, 0x001e2921, 0x001e2a11, 0x001e2b21, 0x001e2c11, 0x001e2d21, 0x001e2e11, 0x001e2f21,
+    0x001e3011, 0x001e3121, 0x001e3211, 0x001e3321, 0x001e3411, 0x001e3521, 0x001e3611, 0x001e3721,
+    0x001e3811, 0x001e3921, 0x001e3a11, 0x001e3b21, 0x001e3c11, 0x001e3d21, 0x001e3e11, 0x001e3f21,
+    0x001e4011, 0x001e4121, 0x001e4211, 0x001e4321, 0x001e4411, 0x001e4521, 0x001e4611, 0x001e4721,
+    0x001e4811, 0x001e4921, 0x001e4a11, 0x001e4b21, 0x001e4c11, 0x001e4d21, 0x001e4e11, 0x001e4f21,
+    0x001e5011, 0x001e5121, 0x001e5211, 0x001e5321, 0x001e5411, 0x001e5521, 0x001e5611, 0x001e5721,
+    0x001e5811, 0x001e5921, 0x001e5a11, 0x001e5b21, 0x001e5c11, 0x001e5d21, 0x001e5e11, 0x001e5f21,
+    0x001e6011, 0x001e6121, 0x001e6211, 0x001e6321, 0x001e6411, 0x001e6521, 0x001e6611, 0x001e6721,
+    0x001e6811, 0x001e6921, 0x001e6a11, 0x001e6b21, 0x001e6c11, 0x001e6d21, 0x001e6e11, 0x001e6f21,
+    0x001e7011, 0x001e7121, 0x001e7211, 0x001e7321, 0x001e7411, 0x001e7521, 0x001e7611, 0x001e7721,
+    0x001e7811, 0x001e7921, 0x001e7a11, 0x001e7b21, 0x001e7c11, 0x001e7d21, 0x001e7e11, 0x001e7f21,
+    0x001e8011, 0x001e8121, 0x001e8211, 0x001e8321, 0x001e8411, 0x001e8521, 0x001e8611, 0x001e8721,
+    0x001e8811, 0x001e8921, 0x001e8a11, 0x001e8b21, 0x001e8c11, 0x001e8d21, 0x001e8e11, 0x001e8f21,
+    0x001e9011, 0x001e9121, 0x001e9211, 0x001e9321, 0x001e9411, 0x001e9521, 0x001e9e11, 0x001e9f21,
+    0x001ea011, 0x001ea121, 0x001ea211, 0x001ea321, 0x001ea411, 0x001ea521, 0x001ea611, 0x001ea721,
+    0x001ea811, 0x001ea921, 0x001eaa11, 0x001eab21, 0x001eac11, 0x001ead21, 0x001eae11, 0x001eaf21,
+    0x001eb011, 0x001eb121, 0x001eb211, 0x001eb321, 0x001eb411, 0x001eb521, 0x001eb611, 0x001eb721,
+    0x001eb811, 0x001eb921, 0x001eba11, 0x001ebb21, 0x001ebc11, 0x001ebd21, 0x001ebe11, 0x001ebf21,
+    0x001ec011, 0x001ec121, 0x001ec211, 0x001ec321, 0x001ec411, 0x001ec521, 0x001ec611, 0x001ec721,
+    0x001ec811, 0x001ec921, 0x001eca11, 0x001ecb21, 0x001ecc11, 0x001ecd21, 0x001ece11, 0x001ecf21,
+    0x001ed011, 0x001ed121, 0x001ed211, 0x001ed321, 0x001ed411, 0x001ed521, 0x001ed611, 0x001ed721,
+    0x001ed811, 0x001ed921, 0x001eda11, 0x001edb21, 0x001edc11, 0x001edd21, 0x001ede11, 0x001edf21,
+    0x001ee011, 0x001ee121, 0x001ee211, 0x001ee321, 0x001ee411, 0x001ee521, 0x001ee611, 0x001ee721,
+    0x001ee811, 0x001ee921, 0x001eea11, 0x001eeb21, 0x001eec11, 0x001eed21, 0x001eee11, 0x001eef21,
+    0x001ef011, 0x001ef121, 0x001ef211, 0x001ef321, 0x001ef411, 0x001ef521, 0x001ef611, 0x001ef721,
+    0x001ef811, 0x001ef921, 0x001efa11, 0x001efb21, 0x001efc11, 0x001efd21, 0x001efe11, 0x001eff21,
+    0x001f0811, 0x001f1021, 0x001f1600, 0x001f1811, 0x001f1e00, 0x001f2021, 0x001f2811, 0x001f3021,
+    0x001f3811, 0x001f4021, 0x001f4600, 0x001f4811, 0x001f4e00, 0x001f5021, 0x001f5800, 0x001f5911,
+    0x001f5a00, 0x001f5b11, 0x001f5c00, 0x001f5d11, 0x001f5e00, 0x001f5f11, 0x001f6021, 0x001f6811,
+    0x001f7021, 0x001f7e00, 0x001f8021, 0x001f8801, 0x001f9021, 0x001f9801, 0x001fa021, 0x001fa801,
+    0x001fb021, 0x001fb500, 0x001fb621, 0x001fb811, 0x001fbc01, 0x001fbd00, 0x001fbe21, 0x001fbf00,
+    0x001fc221, 0x001fc500, 0x001fc621, 0x001fc811, 0x001fcc01, 0x001fcd00, 0x001fd021, 0x001fd400,
+    0x001fd621, 0x001fd811, 0x001fdc00, 0x001fe021, 0x001fe811, 0x001fed00, 0x001ff221, 0x001ff500,
+    0x001ff621, 0x001ff811, 0x001ffc01, 0x001ffd00, 0x00200004, 0x00200b00, 0x00201008, 0x00202804,
+    0x00202a00, 0x00202f04, 0x00203008, 0x00204400, 0x00204508, 0x00205200, 0x00205308, 0x00205f04,
+    0x00206000, 0x00207101, 0x00207200, 0x00207d08, 0x00207f01, 0x00208000, 0x00208d08, 0x00208f00,
+    0x00209001, 0x00209d00, 0x00210211, 0x00210300, 0x00210711, 0x00210800, 0x00210a21, 0x00210b11,
+    0x00210e21, 0x00211011, 0x00211321, 0x00211400, 0x00211511, 0x00211600, 0x00211911, 0x00211e00,
+    0x00212411, 0x00212500, 0x00212611, 0x00212700, 0x00212811, 0x00212900, 0x00212a11, 0x00212e00,
+    0x00212f21, 0x00213011, 0x00213421, 0x00213501, 0x00213921, 0x00213a00, 0x00213c21, 0x00213e11,
+    0x00214000, 0x00214511, 0x00214621, 0x00214a00, 0x00214e21, 0x00214f00, 0x00216001, 0x00218311,
+    0x00218421, 0x00218501, 0x00218900, 0x00230808, 0x00230c00, 0x00232908, 0x00232b00, 0x00276808,
+    0x00277600, 0x0027c508, 0x0027c700, 0x0027e608, 0x0027f000, 0x00298308, 0x00299900, 0x0029d808,
+    0x0029dc00, 0x0029fc08, 0x0029fe00, 0x002c0011, 0x002c3021, 0x002c6011, 0x002c6121, 0x002c6211,
+    0x002c6521, 0x002c6711, 0x002c6821, 0x002c6911, 0x002c6a21, 0x002c6b11, 0x002c6c21, 0x002c6d11,
+    0x002c7121, 0x002c7211, 0x002c7321, 0x002c7511, 0x002c7621, 0x002c7c01, 0x002c7e11, 0x002c8121,
+    0x002c8211, 0x002c8321, 0x002c8411, 0x002c8521, 0x002c8611, 0x002c8721, 0x002c8811, 0x002c8921,
+    0x002c8a11, 0x002c8b21, 0x002c8c11, 0x002c8d21, 0x002c8e11, 0x002c8f21, 0x002c9011, 0x002c9121,
+    0x002c9211, 0x002c9321, 0x002c9411, 0x002c9521, 0x002c9611, 0x002c9721, 0x002c9811, 0x002c9921,
+    0x002c9a11, 0x002c9b21, 0x002c9c11, 0x002c9d21, 0x002c9e11, 0x002c9f21, 0x002ca011, 0x002ca121,
+    0x002ca211, 0x002ca321, 0x002ca411, 0x002ca521, 0x002ca611, 0x002ca721, 0x002ca811, 0x002ca921,
+    0x002caa11, 0x002cab21, 0x002cac11, 0x002cad21, 0x002cae11, 0x002caf21, 0x002cb011, 0x002cb121,
+    0x002cb211, 0x002cb321, 0x002cb411, 0x002cb521, 0x002cb611, 0x002cb721, 0x002cb811, 0x002cb921,
+    0x002cba11, 0x002cbb21, 0x002cbc11, 0x002cbd21, 0x002cbe11, 0x002cbf21, 0x002cc011, 0x002cc121,
+    0x002cc211, 0x002cc321, 0x002cc411, 0x002cc521, 0x002cc611, 0x002cc721, 0x002cc811, 0x002cc921,
+    0x002cca11, 0x002ccb21, 0x002ccc11, 0x002ccd21, 0x002cce11, 0x002ccf21, 0x002cd011, 0x002cd121,
+    0x002cd211, 0x002cd321, 0x002cd411, 0x002cd521, 0x002cd611, 0x002cd721, 0x002cd811, 0x002cd921,
+    0x002cda11, 0x002cdb21, 0x002cdc11, 0x002cdd21, 0x002cde11, 0x002cdf21, 0x002ce011, 0x002ce121,
+    0x002ce211, 0x002ce321, 0x002ce500, 0x002ceb11, 0x002cec21, 0x002ced11, 0x002cee21, 0x002cef00,
+    0x002cf211, 0x002cf321, 0x002cf400, 0x002cf908, 0x002cfd00, 0x002cfe08, 0x002d0021, 0x002d2600,
+    0x002d2721, 0x002d2800, 0x002d2d21, 0x002d2e00, 0x002d3001, 0x002d6800, 0x002d6f01, 0x002d7008,
+    0x002d7100, 0x002d8001, 0x002d9700, 0x002da001, 0x002da700, 0x002da801, 0x002daf00, 0x002db001,
+    0x002db700, 0x002db801, 0x002dbf00, 0x002dc001, 0x002dc700, 0x002dc801, 0x002dcf00, 0x002dd001,
+    0x002dd700, 0x002dd801, 0x002ddf00, 0x002e0008, 0x002e2f01, 0x002e3008, 0x002e5000, 0x002e5208,
+    0x002e5e00, 0x00300004, 0x00300108, 0x00300400, 0x00300501, 0x00300808, 0x00301200, 0x00301408,
+    0x00302000, 0x00302101, 0x00302a00, 0x00303008, 0x00303101, 0x00303600, 0x00303801, 0x00303d08,
+    0x00303e00, 0x00304101, 0x00309700, 0x00309d01, 0x0030a008, 0x0030a101, 0x0030fb08, 0x0030fc01,
+    0x00310000, 0x00310501, 0x00313000, 0x00313101, 0x00318f00, 0x0031a001, 0x0031c000, 0x0031f001,
+    0x00320000, 0x00340001, 0x004dc000, 0x004e0001, 0x00a48d00, 0x00a4d001, 0x00a4fe08, 0x00a50001,
+    0x00a60d08, 0x00a61001, 0x00a62002, 0x00a62a01, 0x00a62c00, 0x00a64011, 0x00a64121, 0x00a64211,
+    0x00a64321, 0x00a64411, 0x00a64521, 0x00a64611, 0x00a64721, 0x00a64811, 0x00a64921, 0x00a64a11,
+    0x00a64b21, 0x00a64c11, 0x00a64d21, 0x00a64e11, 0x00a64f21, 0x00a65011, 0x00a65121, 0x00a65211,
+    0x00a65321, 0x00a65411, 0x00a65521, 0x00a65611, 0x00a65721, 0x00a65811, 0x00a65921, 0x00a65a11,
+    0x00a65b21, 0x00a65c11, 0x00a65d21, 0x00a65e11, 0x00a65f21, 0x00a66011, 0x00a66121, 0x00a66211,
+    0x00a66321, 0x00a66411, 0x00a66521, 0x00a66611, 0x00a66721, 0x00a66811, 0x00a66921, 0x00a66a11,
+    0x00a66b21, 0x00a66c11, 0x00a66d21, 0x00a66e01, 0x00a66f00, 0x00a67308, 0x00a67400, 0x00a67e08,
+    0x00a67f01, 0x00a68011, 0x00a68121, 0x00a68211, 0x00a68321, 0x00a68411, 0x00a68521, 0x00a68611,
+    0x00a68721, 0x00a68811, 0x00a68921, 0x00a68a11, 0x00a68b21, 0x00a68c11, 0x00a68d21, 0x00a68e11,
+    0x00a68f21, 0x00a69011, 0x00a69121, 0x00a69211, 0x00a69321, 0x00a69411, 0x00a69521, 0x00a69611,
+    0x00a69721, 0x00a69811, 0x00a69921, 0x00a69a11, 0x00a69b21, 0x00a69c01, 0x00a69e00, 0x00a6a001,
+    0x00a6f000, 0x00a6f208, 0x00a6f800, 0x00a71701, 0x00a72000, 0x00a72211, 0x00a72321, 0x00a72411,
+    0x00a72521, 0x00a72611, 0x00a72721, 0x00a72811, 0x00a72921, 0x00a72a11, 0x00a72b21, 0x00a72c11,
+    0x00a72d21, 0x00a72e11, 0x00a72f21, 0x00a73211, 0x00a73321, 0x00a73411, 0x00a73521, 0x00a73611,
+    0x00a73721, 0x00a73811, 0x00a73921, 0x00a73a11, 0x00a73b21, 0x00a73c11, 0x00a73d21, 0x00a73e11,
+    0x00a73f21, 0x00a74011, 0x00a74121, 0x00a74211, 0x00a74321, 0x00a74411, 0x00a74521, 0x00a74611,
+    0x00a74721, 0x00a74811, 0x00a74921, 0x00a74a11, 0x00a74b21, 0x00a74c11, 0x00a74d21, 0x00a74e11,
+    0x00a74f21, 0x00a75011, 0x00a75121, 0x00a75211, 0x00a75321, 0x00a75411, 0x00a75521, 0x00a75611,
+    0x00a75721, 0x00a75811, 0x00a75921, 0x00a75a11, 0x00a75b21, 0x00a75c11, 0x00a75d21, 0x00a75e11,
+    0x00a75f21, 0x00a76011, 0x00a76121, 0x00a76211, 0x00a76321, 0x00a76411, 0x00a76521, 0x00a76611,
+    0x00a76721, 0x00a76811, 0x00a76921, 0x00a76a11, 0x00a76b21, 0x00a76c11, 0x00a76d21, 0x00a76e11,
+    0x00a76f21, 0x00a77001, 0x00a77121, 0x00a77911, 0x00a77a21, 0x00a77b11, 0x00a77c21, 0x00a77d11,
+    0x00a77f21, 0x00a78011, 0x00a78121, 0x00a78211, 0x00a78321, 0x00a78411, 0x00a78521, 0x00a78611,
+    0x00a78721, 0x00a78801, 0x00a78900, 0x00a78b11, 0x00a78c21, 0x00a78d11, 0x00a78e21, 0x00a78f01,
+    0x00a79011, 0x00a79121, 0x00a79211, 0x00a79321, 0x00a79611, 0x00a79721, 0x00a79811, 0x00a79921,
+    0x00a79a11, 0x00a79b21, 0x00a79c11, 0x00a79d21, 0x00a79e11, 0x00a79f21, 0x00a7a011, 0x00a7a121,
+    0x00a7a211, 0x00a7a321, 0x00a7a411, 0x00a7a521, 0x00a7a611, 0x00a7a721, 0x00a7a811, 0x00a7a921,
+    0x00a7aa11, 0x00a7af21, 0x00a7b011, 0x00a7b521, 0x00a7b611, 0x00a7b721, 0x00a7b811, 0x00a7b921,
+    0x00a7ba11, 0x00a7bb21, 0x00a7bc11, 0x00a7bd21, 0x00a7be11, 0x00a7bf21, 0x00a7c011, 0x00a7c121,
+    0x00a7c211, 0x00a7c321, 0x00a7c411, 0x00a7c821, 0x00a7c911, 0x00a7ca21, 0x00a7cb00, 0x00a7d011,
+    0x00a7d121, 0x00a7d200, 0x00a7d321, 0x00a7d400, 0x00a7d521, 0x00a7d611, 0x00a7d721, 0x00a7d811,
+    0x00a7d921, 0x00a7da00, 0x00a7f201, 0x00a7f511, 0x00a7f621, 0x00a7f701, 0x00a7fa21, 0x00a7fb01,
+    0x00a80200, 0x00a80301, 0x00a80600, 0x00a80701, 0x00a80b00, 0x00a80c01, 0x00a82300, 0x00a84001,
+    0x00a87408, 0x00a87800, 0x00a88201, 0x00a8b400, 0x00a8ce08, 0x00a8d002, 0x00a8da00, 0x00a8f201,
+    0x00a8f808, 0x00a8fb01, 0x00a8fc08, 0x00a8fd01, 0x00a8ff00, 0x00a90002, 0x00a90a01, 0x00a92600,
+    0x00a92e08, 0x00a93001, 0x00a94700, 0x00a95f08, 0x00a96001, 0x00a97d00, 0x00a98401, 0x00a9b300,
+    0x00a9c108, 0x00a9ce00, 0x00a9cf01, 0x00a9d002, 0x00a9da00, 0x00a9de08, 0x00a9e001, 0x00a9e500,
+    0x00a9e601, 0x00a9f002, 0x00a9fa01, 0x00a9ff00, 0x00aa0001, 0x00aa2900, 0x00aa4001, 0x00aa4300,
+    0x00aa4401, 0x00aa4c00, 0x00aa5002, 0x00aa5a00, 0x00aa5c08, 0x00aa6001, 0x00aa7700, 0x00aa7a01,
+    0x00aa7b00, 0x00aa7e01, 0x00aab000, 0x00aab101, 0x00aab200, 0x00aab501, 0x00aab700, 0x00aab901,
+    0x00aabe00, 0x00aac001, 0x00aac100, 0x00aac201, 0x00aac300, 0x00aadb01, 0x00aade08, 0x00aae001,
+    0x00aaeb00, 0x00aaf008, 0x00aaf201, 0x00aaf500, 0x00ab0101, 0x00ab0700, 0x00ab0901, 0x00ab0f00,
+    0x00ab1101, 0x00ab1700, 0x00ab2001, 0x00ab2700, 0x00ab2801, 0x00ab2f00, 0x00ab3021, 0x00ab5b00,
+    0x00ab5c01, 0x00ab6021, 0x00ab6901, 0x00ab6a00, 0x00ab7021, 0x00abc001, 0x00abe300, 0x00abeb08,
+    0x00abec00, 0x00abf002, 0x00abfa00, 0x00ac0001, 0x00d7a400, 0x00d7b001, 0x00d7c700, 0x00d7cb01,
+    0x00d7fc00, 0x00f90001, 0x00fa6e00, 0x00fa7001, 0x00fada00, 0x00fb0021, 0x00fb0700, 0x00fb1321,
+    0x00fb1800, 0x00fb1d01, 0x00fb1e00, 0x00fb1f01, 0x00fb2900, 0x00fb2a01, 0x00fb3700, 0x00fb3801,
+    0x00fb3d00, 0x00fb3e01, 0x00fb3f00, 0x00fb4001, 0x00fb4200, 0x00fb4301, 0x00fb4500, 0x00fb4601,
+    0x00fbb200, 0x00fbd301, 0x00fd3e08, 0x00fd4000, 0x00fd5001, 0x00fd9000, 0x00fd9201, 0x00fdc800,
+    0x00fdf001, 0x00fdfc00, 0x00fe1008, 0x00fe1a00, 0x00fe3008, 0x00fe5300, 0x00fe5408, 0x00fe6200,
+    0x00fe6308, 0x00fe6400, 0x00fe6808, 0x00fe6900, 0x00fe6a08, 0x00fe6c00, 0x00fe7001, 0x00fe7500,
+    0x00fe7601, 0x00fefd00, 0x00ff0108, 0x00ff0400, 0x00ff0508, 0x00ff0b00, 0x00ff0c08, 0x00ff1002,
+    0x00ff1a08, 0x00ff1c00, 0x00ff1f08, 0x00ff2111, 0x00ff3b08, 0x00ff3e00, 0x00ff3f08, 0x00ff4000,
+    0x00ff4121, 0x00ff5b08, 0x00ff5c00, 0x00ff5d08, 0x00ff5e00, 0x00ff5f08, 0x00ff6601, 0x00ffbf00,
+    0x00ffc201, 0x00ffc800, 0x00ffca01, 0x00ffd000, 0x00ffd201, 0x00ffd800, 0x00ffda01, 0x00ffdd00,
+    0x01000001, 0x01000c00, 0x01000d01, 0x01002700, 0x01002801, 0x01003b00, 0x01003c01, 0x01003e00,
+    0x01003f01, 0x01004e00, 0x01005001, 0x01005e00, 0x01008001, 0x0100fb00, 0x01010008, 0x01010300,
+    0x01014001, 0x01017500, 0x01028001, 0x01029d00, 0x0102a001, 0x0102d100, 0x01030001, 0x01032000,
+    0x01032d01, 0x01034b00, 0x01035001, 0x01037600, 0x01038001, 0x01039e00, 0x01039f08, 0x0103a001,
+    0x0103c400, 0x0103c801, 0x0103d008, 0x0103d101, 0x0103d600, 0x01040011, 0x01042821, 0x01045001,
+    0x01049e00, 0x0104a002, 0x0104aa00, 0x0104b011, 0x0104d400, 0x0104d821, 0x0104fc00, 0x01050001,
+    0x01052800, 0x01053001, 0x01056400, 0x01056f08, 0x01057011, 0x01057b00, 0x01057c11, 0x01058b00,
+    0x01058c11, 0x01059300, 0x01059411, 0x01059600, 0x01059721, 0x0105a200, 0x0105a321, 0x0105b200,
+    0x0105b321, 0x0105ba00, 0x0105bb21, 0x0105bd00, 0x01060001, 0x01073700, 0x01074001, 0x01075600,
+    0x01076001, 0x01076800, 0x01078001, 0x01078600, 0x01078701, 0x0107b100, 0x0107b201, 0x0107bb00,
+    0x01080001, 0x01080600, 0x01080801, 0x01080900, 0x01080a01, 0x01083600, 0x01083701, 0x01083900,
+    0x01083c01, 0x01083d00, 0x01083f01, 0x01085600, 0x01085708, 0x01085800, 0x01086001, 0x01087700,
+    0x01088001, 0x01089f00, 0x0108e001, 0x0108f300, 0x0108f401, 0x0108f600, 0x01090001, 0x01091600,
+    0x01091f08, 0x01092001, 0x01093a00, 0x01093f08, 0x01094000, 0x01098001, 0x0109b800, 0x0109be01,
+    0x0109c000, 0x010a0001, 0x010a0100, 0x010a1001, 0x010a1400, 0x010a1501, 0x010a1800, 0x010a1901,
+    0x010a3600, 0x010a5008, 0x010a5900, 0x010a6001, 0x010a7d00, 0x010a7f08, 0x010a8001, 0x010a9d00,
+    0x010ac001, 0x010ac800, 0x010ac901, 0x010ae500, 0x010af008, 0x010af700, 0x010b0001, 0x010b3600,
+    0x010b3908, 0x010b4001, 0x010b5600, 0x010b6001, 0x010b7300, 0x010b8001, 0x010b9200, 0x010b9908,
+    0x010b9d00, 0x010c0001, 0x010c4900, 0x010c8011, 0x010cb300, 0x010cc021, 0x010cf300, 0x010d0001,
+    0x010d2400, 0x010d3002, 0x010d3a00, 0x010e8001, 0x010eaa00, 0x010ead08, 0x010eae00, 0x010eb001,
+    0x010eb200, 0x010f0001, 0x010f1d00, 0x010f2701, 0x010f2800, 0x010f3001, 0x010f4600, 0x010f5508,
+    0x010f5a00, 0x010f7001, 0x010f8200, 0x010f8608, 0x010f8a00, 0x010fb001, 0x010fc500, 0x010fe001,
+    0x010ff700, 0x01100301, 0x01103800, 0x01104708, 0x01104e00, 0x01106602, 0x01107000, 0x01107101,
+    0x01107300, 0x01107501, 0x01107600, 0x01108301, 0x0110b000, 0x0110bb08, 0x0110bd00, 0x0110be08,
+    0x0110c200, 0x0110d001, 0x0110e900, 0x0110f002, 0x0110fa00, 0x01110301, 0x01112700, 0x01113602,
+    0x01114008, 0x01114401, 0x01114500, 0x01114701, 0x01114800, 0x01115001, 0x01117300, 0x01117408,
+    0x01117601, 0x01117700, 0x01118301, 0x0111b300, 0x0111c101, 0x0111c508, 0x0111c900, 0x0111cd08,
+    0x0111ce00, 0x0111d002, 0x0111da01, 0x0111db08, 0x0111dc01, 0x0111dd08, 0x0111e000, 0x01120001,
+    0x01121200, 0x01121301, 0x01122c00, 0x01123808, 0x01123e00, 0x01128001, 0x01128700, 0x01128801,
+    0x01128900, 0x01128a01, 0x01128e00, 0x01128f01, 0x01129e00, 0x01129f01, 0x0112a908, 0x0112aa00,
+    0x0112b001, 0x0112df00, 0x0112f002, 0x0112fa00, 0x01130501, 0x01130d00, 0x01130f01, 0x01131100,
+    0x01131301, 0x01132900, 0x01132a01, 0x01133100, 0x01133201, 0x01133400, 0x01133501, 0x01133a00,
+    0x01133d01, 0x01133e00, 0x01135001, 0x01135100, 0x01135d01, 0x01136200, 0x01140001, 0x01143500,
+    0x01144701, 0x01144b08, 0x01145002, 0x01145a08, 0x01145c00, 0x01145d08, 0x01145e00, 0x01145f01,
+    0x01146200, 0x01148001, 0x0114b000, 0x0114c401, 0x0114c608, 0x0114c701, 0x0114c800, 0x0114d002,
+    0x0114da00, 0x01158001, 0x0115af00, 0x0115c108, 0x0115d801, 0x0115dc00, 0x01160001, 0x01163000,
+    0x01164108, 0x01164401, 0x01164500, 0x01165002, 0x01165a00, 0x01166008, 0x01166d00, 0x01168001,
+    0x0116ab00, 0x0116b801, 0x0116b908, 0x0116ba00, 0x0116c002, 0x0116ca00, 0x01170001, 0x01171b00,
+    0x01173002, 0x01173a00, 0x01173c08, 0x01173f00, 0x01174001, 0x01174700, 0x01180001, 0x01182c00,
+    0x01183b08, 0x01183c00, 0x0118a011, 0x0118c021, 0x0118e002, 0x0118ea00, 0x0118ff01, 0x01190700,
+    0x01190901, 0x01190a00, 0x01190c01, 0x01191400, 0x01191501, 0x01191700, 0x01191801, 0x01193000,
+    0x01193f01, 0x01194000, 0x01194101, 0x01194200, 0x01194408, 0x01194700, 0x01195002, 0x01195a00,
+    0x0119a001, 0x0119a800, 0x0119aa01, 0x0119d100, 0x0119e101, 0x0119e208, 0x0119e301, 0x0119e400,
+    0x011a0001, 0x011a0100, 0x011a0b01, 0x011a3300, 0x011a3a01, 0x011a3b00, 0x011a3f08, 0x011a4700,
+    0x011a5001, 0x011a5100, 0x011a5c01, 0x011a8a00, 0x011a9a08, 0x011a9d01, 0x011a9e08, 0x011aa300,
+    0x011ab001, 0x011af900, 0x011c0001, 0x011c0900, 0x011c0a01, 0x011c2f00, 0x011c4001, 0x011c4108,
+    0x011c4600, 0x011c5002, 0x011c5a00, 0x011c7008, 0x011c7201, 0x011c9000, 0x011d0001, 0x011d0700,
+    0x011d0801, 0x011d0a00, 0x011d0b01, 0x011d3100, 0x011d4601, 0x011d4700, 0x011d5002, 0x011d5a00,
+    0x011d6001, 0x011d6600, 0x011d6701, 0x011d6900, 0x011d6a01, 0x011d8a00, 0x011d9801, 0x011d9900,
+    0x011da002, 0x011daa00, 0x011ee001, 0x011ef300, 0x011ef708, 0x011ef900, 0x011fb001, 0x011fb100,
+    0x011fff08, 0x01200001, 0x01239a00, 0x01240001, 0x01246f00, 0x01247008, 0x01247500, 0x01248001,
+    0x01254400, 0x012f9001, 0x012ff108, 0x012ff300, 0x01300001, 0x01342f00, 0x01440001, 0x01464700,
+    0x01680001, 0x016a3900, 0x016a4001, 0x016a5f00, 0x016a6002, 0x016a6a00, 0x016a6e08, 0x016a7001,
+    0x016abf00, 0x016ac002, 0x016aca00, 0x016ad001, 0x016aee00, 0x016af508, 0x016af600, 0x016b0001,
+    0x016b3000, 0x016b3708, 0x016b3c00, 0x016b4001, 0x016b4408, 0x016b4500, 0x016b5002, 0x016b5a00,
+    0x016b6301, 0x016b7800, 0x016b7d01, 0x016b9000, 0x016e4011, 0x016e6021, 0x016e8000, 0x016e9708,
+    0x016e9b00, 0x016f0001, 0x016f4b00, 0x016f5001, 0x016f5100, 0x016f9301, 0x016fa000, 0x016fe001,
+    0x016fe208, 0x016fe301, 0x016fe400, 0x01700001, 0x0187f800, 0x01880001, 0x018cd600, 0x018d0001,
+    0x018d0900, 0x01aff001, 0x01aff400, 0x01aff501, 0x01affc00, 0x01affd01, 0x01afff00, 0x01b00001,
+    0x01b12300, 0x01b15001, 0x01b15300, 0x01b16401, 0x01b16800, 0x01b17001, 0x01b2fc00, 0x01bc0001,
+    0x01bc6b00, 0x01bc7001, 0x01bc7d00, 0x01bc8001, 0x01bc8900, 0x01bc9001, 0x01bc9a00, 0x01bc9f08,
+    0x01bca000, 0x01d40011, 0x01d41a21, 0x01d43411, 0x01d44e21, 0x01d45500, 0x01d45621, 0x01d46811,
+    0x01d48221, 0x01d49c11, 0x01d49d00, 0x01d49e11, 0x01d4a000, 0x01d4a211, 0x01d4a300, 0x01d4a511,
+    0x01d4a700, 0x01d4a911, 0x01d4ad00, 0x01d4ae11, 0x01d4b621, 0x01d4ba00, 0x01d4bb21, 0x01d4bc00,
+    0x01d4bd21, 0x01d4c400, 0x01d4c521, 0x01d4d011, 0x01d4ea21, 0x01d50411, 0x01d50600, 0x01d50711,
+    0x01d50b00, 0x01d50d11, 0x01d51500, 0x01d51611, 0x01d51d00, 0x01d51e21, 0x01d53811, 0x01d53a00,
+    0x01d53b11, 0x01d53f00, 0x01d54011, 0x01d54500, 0x01d54611, 0x01d54700, 0x01d54a11, 0x01d55100,
+    0x01d55221, 0x01d56c11, 0x01d58621, 0x01d5a011, 0x01d5ba21, 0x01d5d411, 0x01d5ee21, 0x01d60811,
+    0x01d62221, 0x01d63c11, 0x01d65621, 0x01d67011, 0x01d68a21, 0x01d6a600, 0x01d6a811, 0x01d6c100,
+    0x01d6c221, 0x01d6db00, 0x01d6dc21, 0x01d6e211, 0x01d6fb00, 0x01d6fc21, 0x01d71500, 0x01d71621,
+    0x01d71c11, 0x01d73500, 0x01d73621, 0x01d74f00, 0x01d75021, 0x01d75611, 0x01d76f00, 0x01d77021,
+    0x01d78900, 0x01d78a21, 0x01d79011, 0x01d7a900, 0x01d7aa21, 0x01d7c300, 0x01d7c421, 0x01d7ca11,
+    0x01d7cb21, 0x01d7cc00, 0x01d7ce02, 0x01d80000, 0x01da8708, 0x01da8c00, 0x01df0021, 0x01df0a01,
+    0x01df0b21, 0x01df1f00, 0x01e10001, 0x01e12d00, 0x01e13701, 0x01e13e00, 0x01e14002, 0x01e14a00,
+    0x01e14e01, 0x01e14f00, 0x01e29001, 0x01e2ae00, 0x01e2c001, 0x01e2ec00, 0x01e2f002, 0x01e2fa00,
+    0x01e7e001, 0x01e7e700, 0x01e7e801, 0x01e7ec00, 0x01e7ed01, 0x01e7ef00, 0x01e7f001, 0x01e7ff00,
+    0x01e80001, 0x01e8c500, 0x01e90011, 0x01e92221, 0x01e94400, 0x01e94b01, 0x01e94c00, 0x01e95002,
+    0x01e95a00, 0x01e95e08, 0x01e96000, 0x01ee0001, 0x01ee0400, 0x01ee0501, 0x01ee2000, 0x01ee2101,
+    0x01ee2300, 0x01ee2401, 0x01ee2500, 0x01ee2701, 0x01ee2800, 0x01ee2901, 0x01ee3300, 0x01ee3401,
+    0x01ee3800, 0x01ee3901, 0x01ee3a00, 0x01ee3b01, 0x01ee3c00, 0x01ee4201, 0x01ee4300, 0x01ee4701,
+    0x01ee4800, 0x01ee4901, 0x01ee4a00, 0x01ee4b01, 0x01ee4c00, 0x01ee4d01, 0x01ee5000, 0x01ee5101,
+    0x01ee5300, 0x01ee5401, 0x01ee5500, 0x01ee5701, 0x01ee5800, 0x01ee5901, 0x01ee5a00, 0x01ee5b01,
+    0x01ee5c00, 0x01ee5d01, 0x01ee5e00, 0x01ee5f01, 0x01ee6000, 0x01ee6101, 0x01ee6300, 0x01ee6401,
+    0x01ee6500, 0x01ee6701, 0x01ee6b00, 0x01ee6c01, 0x01ee7300, 0x01ee7401, 0x01ee7800, 0x01ee7901,
+    0x01ee7d00, 0x01ee7e01, 0x01ee7f00, 0x01ee8001, 0x01ee8a00, 0x01ee8b01, 0x01ee9c00, 0x01eea101,
+    0x01eea400, 0x01eea501, 0x01eeaa00, 0x01eeab01, 0x01eebc00, 0x01fbf002, 0x01fbfa00, 0x02000001,
+    0x02a6e000, 0x02a70001, 0x02b73900, 0x02b74001, 0x02b81e00, 0x02b82001, 0x02cea200, 0x02ceb001,
+    0x02ebe100, 0x02f80001, 0x02fa1e00, 0x03000001, 0x03134b00,
+};
+
+#endif /* UNICODE_TABLES_HPP */
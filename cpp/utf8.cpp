@@ -1,12 +1,43 @@
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <chrono>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <print>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
-auto utf8_sequence_length(unsigned char lead_byte) -> size_t {
+#if defined(__SSE2__)
+ #include <immintrin.h>
+#endif
+
+#include "bitset.hpp"
+#include "unicode_tables.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+constexpr auto utf8_sequence_length(unsigned char lead_byte) -> size_t {
   if (lead_byte <= 127) return 1;
-  if (lead_byte <= 128 + 63) return 2;
-  if (lead_byte <= 128 + 64 + 31) return 3;
-  if (lead_byte <= 128 + 64 + 32 + 15) return 4;
+  if (lead_byte <= 128 + 63) return 0;  // Continuation byte
+  if (lead_byte <= 128 + 64 + 31) return 2;
+  if (lead_byte <= 128 + 64 + 32 + 15) return 3;
+  if (lead_byte <= 128 + 64 + 32 + 16 + 7) return 4;
 
   return 0;
 }
@@ -16,9 +47,9 @@ struct Cursor {
   const T *begin_ = nullptr;
   const T *end_   = nullptr;
 
-  Cursor() : begin_(nullptr), end_(nullptr) {}
+  constexpr Cursor() : begin_(nullptr), end_(nullptr) {}
 
-  Cursor(std::span<const T> span) : begin_(span.data()), end_(span.data() + span.size()) {}
+  constexpr Cursor(std::span<const T> span) : begin_(span.data()), end_(span.data() + span.size()) {}
 
   constexpr auto operator[](size_t index) -> const T & { return begin_[index]; }
 
@@ -29,6 +60,28 @@ struct Cursor {
     return ret;
   }
 
+  // Reads without the bounds assert, for callers that have already checked
+  // remaining() for the whole sequence or block.
+  constexpr auto next_unchecked() -> const T & { return *begin_++; }
+
+  // Returns the element `n` positions ahead without consuming anything.
+  [[nodiscard]] constexpr auto peek(size_t n = 0) const -> const T & {
+    assert(n < remaining());
+    return begin_[n];
+  }
+
+  // Consumes `n` elements at once, checking the bounds once for all of them.
+  constexpr auto advance(size_t n) -> void {
+    assert(n <= remaining());
+    begin_ += n;
+  }
+
+  constexpr auto take(size_t n) -> std::span<const T> {
+    const std::span<const T> ret(begin_, n);
+    advance(n);
+    return ret;
+  }
+
   [[nodiscard]] constexpr auto remaining() const -> size_t { return end_ - begin_; }
 
   [[nodiscard]] constexpr auto ended() const -> bool { return remaining() == 0; }
@@ -41,51 +94,95 @@ concept Streamable =
       { t.end() };
     };
 
-bool decode_glyph(char32_t &in, Cursor<char> &c) {
-  if (c.remaining() == 0) {
-    in = U'�';
-    return false;
-  }
+constexpr bool decode_glyph(char32_t &in, Cursor<char> &c) {
+  in = U'�';
+  if (c.ended()) return false;
 
-  unsigned char b1 = c.next();
+  const unsigned char b1 = c.next_unchecked();
+  const size_t length    = utf8_sequence_length(b1);
+  if (length == 0 || length - 1 > c.remaining()) return false;
 
-  if (utf8_sequence_length(b1) == 0) {
-    in = U'�';
-    return false;
-  }
-  if (utf8_sequence_length(b1) > c.remaining() + 1) {
-    in = U'�';
-    return false;
-  }
+  // The whole sequence is known to be in bounds, so take it in one step
+  const auto tail = c.take(length - 1);
 
   // clang-format off
-  if (b1 <= 127) {
-    in = b1;
-  }
-  else if (b1 <= 128 + 63) {
-    in = ((0x1f & b1) << 6) |
-         ((0x3f & c.next()));
-  }
-  else if (b1 <= 128 + 64 + 31) {
-    auto b2 = c.next(); // Since evaluation order is unspecified, we need
-    auto b3 = c.next(); // to make sure we grab the correct bytes
-    in = ((0x0f & b1) << 12) |
-         ((0x3f & b2) << 6)  |
-         ((0x3f & b3));
-  }
-  else if (b1 <= 128 + 64 + 32 + 15) {
-    auto b2 = c.next(); // Workaround for unspecified evaluation order
-    auto b3 = c.next();
-    auto b4 = c.next();
-    in = ((0x07 & b1) << 18) |
-         ((0x3f & b2) << 12) |
-         ((0x3f & b3) << 6)  |
-         ((0x3f & b4));
+  switch (length) {
+    case 1:
+      in = b1;
+      break;
+    case 2:
+      in = ((0x1f & b1) << 6) |
+           ((0x3f & tail[0]));
+      break;
+    case 3:
+      in = ((0x0f & b1) << 12)     |
+           ((0x3f & tail[0]) << 6) |
+           ((0x3f & tail[1]));
+      break;
+    default:
+      in = ((0x07 & b1) << 18)      |
+           ((0x3f & tail[0]) << 12) |
+           ((0x3f & tail[1]) << 6)  |
+           ((0x3f & tail[2]));
   }  // clang-format on
 
   return true;
 }
 
+// Appends the UTF-8 encoding of `cp` to `out`.
+void encode_glyph(char32_t cp, std::string &out) {
+  char buf[4];
+  size_t len;
+
+  // clang-format off
+  if (cp < 0x80) {
+    buf[0] = cp;
+    len    = 1;
+  }
+  else if (cp < 0x800) {
+    buf[0] = 0xc0 | (cp >> 6);
+    buf[1] = 0x80 | (cp & 0x3f);
+    len    = 2;
+  }
+  else if (cp < 0x10000) {
+    buf[0] = 0xe0 | (cp >> 12);
+    buf[1] = 0x80 | ((cp >> 6) & 0x3f);
+    buf[2] = 0x80 | (cp & 0x3f);
+    len    = 3;
+  }
+  else {
+    buf[0] = 0xf0 | (cp >> 18);
+    buf[1] = 0x80 | ((cp >> 12) & 0x3f);
+    buf[2] = 0x80 | ((cp >> 6) & 0x3f);
+    buf[3] = 0x80 | (cp & 0x3f);
+    len    = 4;
+  }  // clang-format on
+
+  out.append(buf, len);
+}
+
+// Tag base for the adaptors that can be chained onto a Stream with `|`.
+struct Adaptor {};
+
+template <typename Src, typename... Stages>
+struct Pipeline;
+
+// Hands `v` to `sink`, returning whether the sink wants more.
+template <typename Sink, typename T>
+constexpr auto feed(Sink &sink, T &&v) -> bool {
+  if constexpr (std::is_void_v<std::invoke_result_t<Sink &, T>>) {
+    sink(std::forward<T>(v));
+    return true;
+  }
+  else { return sink(std::forward<T>(v)); }
+}
+
+// Tells `sink` that no more items are coming.
+template <typename Sink>
+constexpr void finish(Sink &sink) {
+  if constexpr (requires { sink.finish(); }) sink.finish();
+}
+
 template <Streamable S, typename Next>
 struct Stream {
   using Base = std::remove_cvref_t<decltype(*std::declval<S>().begin())>;
@@ -96,7 +193,7 @@ struct Stream {
   Cursor<Base> cursor_;
   Next next_;
 
-  Stream(S s, Next &&n) : cursor_(s), next_(std::move(n)) {}
+  constexpr Stream(S s, Next &&n) : cursor_(s), next_(std::move(n)) {}
 
   constexpr auto next() { return next_(cursor_); }
 
@@ -132,9 +229,287 @@ struct Stream {
     else { return std::nullopt; }
   }
 
-  // TODO: enumerate -> std::pair(size_t, Item)
+  // Drives the stream into `sink` until it is exhausted or the sink returns
+  // false. Sinks returning void consume everything.
+  template <typename Sink>
+  constexpr void for_each(Sink sink) {
+    while (auto item = next()) {
+      if (!feed(sink, *item)) return;
+    }
+    finish(sink);
+  }
+
+  template <typename T, typename F>
+  constexpr auto fold(T init, F f) -> T {
+    for_each([&](auto &&v) { init = f(std::move(init), std::forward<decltype(v)>(v)); });
+    return init;
+  }
+
+  constexpr auto count() -> size_t {
+    return fold(size_t{0}, [](size_t n, auto &&) { return n + 1; });
+  }
+
+  template <typename Stage>
+  requires std::derived_from<Stage, Adaptor>
+  constexpr auto operator|(Stage stage) && -> Pipeline<Stream, Stage> {
+    return {std::move(*this), std::tuple(std::move(stage))};
+  }
+};
+
+// Lazy adaptors over Stream.
+//
+// Adaptors are push based: each stage wraps the sink that consumes its output,
+// so a pipeline like
+//
+//   iterGraphemes(str) | filter(is_alpha) | map(to_upper) | enumerate()
+//
+// is driven by a single loop over the source with every stage inlined into it.
+// Only the source produces an Item (pointer or optional); stages hand plain
+// values downstream and return false once the pipeline should stop.
+//
+// A stage that ends the stream early (take, take_while, zip) finishes its
+// downstream itself, so buffering stages such as chunk still flush. A false
+// coming back from downstream means it is already done, so it is passed up
+// without finishing anything again.
+
+template <typename Src, typename... Stages>
+struct Pipeline {
+  using In = decltype(*std::declval<typename Src::Item &>());
+
+  Src src_;
+  std::tuple<Stages...> stages_;
+
+  template <typename Stage>
+  requires std::derived_from<Stage, Adaptor>
+  constexpr auto operator|(Stage stage) && -> Pipeline<Src, Stages..., Stage> {
+    return {std::move(src_), std::tuple_cat(std::move(stages_), std::tuple(std::move(stage)))};
+  }
+
+  template <typename Sink>
+  constexpr void for_each(Sink sink) {
+    src_.for_each(build<0, In>(std::move(sink)));
+  }
+
+  template <typename T, typename F>
+  constexpr auto fold(T init, F f) -> T {
+    for_each([&](auto &&v) { init = f(std::move(init), std::forward<decltype(v)>(v)); });
+    return init;
+  }
+
+  constexpr auto count() -> size_t {
+    return fold(size_t{0}, [](size_t n, auto &&) { return n + 1; });
+  }
+
+ private:
+  template <size_t I, typename T, typename Sink>
+  constexpr auto build(Sink sink) {
+    if constexpr (I == sizeof...(Stages)) { return sink; }
+    else {
+      using Stage = std::tuple_element_t<I, std::tuple<Stages...>>;
+      using Out   = typename Stage::template Out<T>;
+      return std::get<I>(stages_).template wrap<T>(build<I + 1, Out>(std::move(sink)));
+    }
+  }
+};
+
+template <typename F>
+struct Map : Adaptor {
+  F f_;
+
+  template <typename In>
+  using Out = std::invoke_result_t<const F &, In>;
+
+  template <typename In, typename Sink>
+  constexpr auto wrap(Sink sink) const {
+    struct Stage {
+      F f;
+      Sink sink;
+
+      constexpr auto operator()(In v) -> bool { return feed(sink, f(std::forward<In>(v))); }
+      constexpr void finish() { ::finish(sink); }
+    };
+    return Stage{f_, std::move(sink)};
+  }
+};
+
+template <typename P>
+struct Filter : Adaptor {
+  P p_;
+
+  template <typename In>
+  using Out = In;
+
+  template <typename In, typename Sink>
+  constexpr auto wrap(Sink sink) const {
+    struct Stage {
+      P p;
+      Sink sink;
+
+      constexpr auto operator()(In v) -> bool { return !p(v) || feed(sink, std::forward<In>(v)); }
+      constexpr void finish() { ::finish(sink); }
+    };
+    return Stage{p_, std::move(sink)};
+  }
+};
+
+struct Take : Adaptor {
+  size_t n_;
+
+  template <typename In>
+  using Out = In;
+
+  template <typename In, typename Sink>
+  constexpr auto wrap(Sink sink) const {
+    struct Stage {
+      size_t left;
+      Sink sink;
+
+      constexpr auto operator()(In v) -> bool {
+        if (left == 0) return stop();
+        if (!feed(sink, std::forward<In>(v))) return false;
+        return --left != 0 || stop();
+      }
+      constexpr auto stop() -> bool {
+        ::finish(sink);
+        return false;
+      }
+      constexpr void finish() { ::finish(sink); }
+    };
+    return Stage{n_, std::move(sink)};
+  }
+};
+
+template <typename P>
+struct TakeWhile : Adaptor {
+  P p_;
+
+  template <typename In>
+  using Out = In;
+
+  template <typename In, typename Sink>
+  constexpr auto wrap(Sink sink) const {
+    struct Stage {
+      P p;
+      Sink sink;
+
+      constexpr auto operator()(In v) -> bool {
+        if (p(v)) return feed(sink, std::forward<In>(v));
+        ::finish(sink);
+        return false;
+      }
+      constexpr void finish() { ::finish(sink); }
+    };
+    return Stage{p_, std::move(sink)};
+  }
+};
+
+struct Enumerate : Adaptor {
+  template <typename In>
+  using Out = std::pair<size_t, std::remove_cvref_t<In>>;
+
+  template <typename In, typename Sink>
+  constexpr auto wrap(Sink sink) const {
+    struct Stage {
+      size_t index;
+      Sink sink;
+
+      constexpr auto operator()(In v) -> bool { return feed(sink, Out<In>{index++, std::forward<In>(v)}); }
+      constexpr void finish() { ::finish(sink); }
+    };
+    return Stage{0, std::move(sink)};
+  }
+};
+
+// Groups items into spans of N; the last span may be shorter. The span
+// points into the stage's buffer and is only valid during the call.
+template <size_t N>
+struct Chunk : Adaptor {
+  static_assert(N > 0);
+
+  template <typename In>
+  using Out = std::span<const std::remove_cvref_t<In>>;
+
+  template <typename In, typename Sink>
+  constexpr auto wrap(Sink sink) const {
+    struct Stage {
+      std::array<std::remove_cvref_t<In>, N> buf{};
+      size_t len = 0;
+      Sink sink;
+
+      constexpr auto operator()(In v) -> bool {
+        buf[len++] = std::forward<In>(v);
+        if (len < N) return true;
+        len = 0;
+        return feed(sink, Out<In>(buf.data(), N));
+      }
+      constexpr void finish() {
+        size_t n = std::exchange(len, 0);
+        if (n == 0 || feed(sink, Out<In>(buf.data(), n))) ::finish(sink);
+      }
+    };
+    return Stage{{}, 0, std::move(sink)};
+  }
+};
+
+// Pairs every item with the next item of another stream, stopping at the
+// shorter of the two.
+template <typename Other>
+struct Zip : Adaptor {
+  Other other_;
+
+  template <typename In>
+  using Out = std::pair<std::remove_cvref_t<In>, typename Other::ValueType>;
+
+  template <typename In, typename Sink>
+  constexpr auto wrap(Sink sink) const {
+    struct Stage {
+      Other other;
+      Sink sink;
+
+      constexpr auto operator()(In v) -> bool {
+        if (auto o = other.next()) return feed(sink, Out<In>{std::forward<In>(v), *o});
+        ::finish(sink);
+        return false;
+      }
+      constexpr void finish() { ::finish(sink); }
+    };
+    return Stage{other_, std::move(sink)};
+  }
 };
 
+template <typename F>
+constexpr auto map(F f) {
+  return Map<F>{{}, std::move(f)};
+}
+
+template <typename P>
+constexpr auto filter(P p) {
+  return Filter<P>{{}, std::move(p)};
+}
+
+constexpr auto take(size_t n) {
+  return Take{{}, n};
+}
+
+template <typename P>
+constexpr auto take_while(P p) {
+  return TakeWhile<P>{{}, std::move(p)};
+}
+
+constexpr auto enumerate() {
+  return Enumerate{};
+}
+
+template <size_t N>
+constexpr auto chunk() {
+  return Chunk<N>{};
+}
+
+template <typename Other>
+constexpr auto zip(Other other) {
+  return Zip<Other>{{}, std::move(other)};
+}
+
 constexpr auto iterGraphemes(std::string_view str) {
   return Stream(
       str,
@@ -156,17 +531,1808 @@ constexpr auto iterChars(std::string_view str) {
   );
 }
 
-int main() {
-  std::string test = "Hello World, from Japan and други места.\n";
+// Read-only view of a whole file mapped into memory.
+//
+// MappedFile is Streamable and converts to std::string_view, so large files
+// can be fed to iterGraphemes/iterChars (or anything taking a string_view)
+// without first being read into a string. Pages are faulted in lazily by the kernel; the
+// mapping is advised as sequential so read-ahead is aggressive and pages
+// behind the reader are dropped early.
+class MappedFile {
+ public:
+  using iterator = const char *;
 
-  size_t len = 0;
-  for (auto ch : iterGraphemes(test)) {
-    std::println("ch: {}", (char)ch);
-    len++;
+  static auto open(const char *path, bool huge_pages = true) -> std::optional<MappedFile> {
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return std::nullopt;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      return std::nullopt;
+    }
+
+    MappedFile file;
+    file.size_ = static_cast<size_t>(st.st_size);
+    if (file.size_ != 0) {
+      void *addr = ::mmap(nullptr, file.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED) {
+        ::close(fd);
+        return std::nullopt;
+      }
+      file.data_ = static_cast<const char *>(addr);
+
+      ::madvise(addr, file.size_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+      // Only honoured for file mappings when the kernel supports read-only
+      // THP for page cache; harmless otherwise.
+      if (huge_pages) ::madvise(addr, file.size_, MADV_HUGEPAGE);
+#endif
+    }
+    ::close(fd);  // The mapping keeps its own reference to the file.
+
+    return file;
   }
 
-  for (auto ch : iterChars(test)) {
-    std::println("ch: {}", ch);
+  MappedFile(const MappedFile &)            = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  MappedFile(MappedFile &&other) noexcept :
+    data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+  MappedFile &operator=(MappedFile &&other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) ::munmap(const_cast<char *>(data_), size_);
+  }
+
+  [[nodiscard]] auto begin() const -> iterator { return data_; }
+  [[nodiscard]] auto end() const -> iterator { return data_ + size_; }
+  [[nodiscard]] auto size() const -> size_t { return size_; }
+
+  [[nodiscard]] auto view() const -> std::string_view { return {data_, size_}; }
+  operator std::string_view() const { return view(); }
+
+ private:
+  MappedFile() = default;
+
+  const char *data_ = nullptr;
+  size_t size_      = 0;
+};
+
+[[nodiscard]] constexpr auto is_continuation(unsigned char b) -> bool { return (b & 0xc0) == 0x80; }
+
+// Loads the 8 bytes at `str[i]` for the word-at-a-time loops below, which do
+// not depend on their order. Constant evaluation assembles them one by one.
+constexpr auto load8(std::string_view str, size_t i) -> uint64_t {
+  if consteval {
+    uint64_t w = 0;
+    for (size_t k = 0; k < 8; ++k) w |= uint64_t{static_cast<unsigned char>(str[i + k])} << (8 * k);
+    return w;
+  }
+  uint64_t w;
+  std::memcpy(&w, str.data() + i, sizeof(w));
+  return w;
+}
+
+constexpr uint64_t high_bits = 0x8080'8080'8080'8080;
+
+// Returns the offset of the first byte that does not start a well-formed
+// sequence (stray continuation, overlong, surrogate, above U+10FFFF or
+// truncated), or str.size() if the whole buffer is valid UTF-8.
+constexpr auto utf8_validate(std::string_view str) -> size_t {
+  const auto byte = [str](size_t i) -> unsigned char { return str[i]; };
+  const size_t n  = str.size();
+
+  size_t i = 0;
+  while (i < n) {
+    if (i + 8 <= n && (load8(str, i) & high_bits) == 0) {
+      i += 8;
+      continue;
+    }
+
+    const unsigned char b1 = byte(i);
+    const size_t len       = utf8_sequence_length(b1);
+    if (len == 1) {
+      ++i;
+      continue;
+    }
+    if (len == 0 || len > n - i || b1 < 0xc2 || b1 > 0xf4) return i;
+
+    // The second byte's range depends on the lead (Unicode Table 3-7)
+    unsigned char lo = 0x80, hi = 0xbf;
+    if (b1 == 0xe0) lo = 0xa0;
+    if (b1 == 0xed) hi = 0x9f;
+    if (b1 == 0xf0) lo = 0x90;
+    if (b1 == 0xf4) hi = 0x8f;
+    if (byte(i + 1) < lo || byte(i + 1) > hi) return i;
+
+    for (size_t k = 2; k < len; ++k) {
+      if (!is_continuation(byte(i + k))) return i;
+    }
+    i += len;
+  }
+
+  return n;
+}
+
+// Counts code points, i.e. the bytes that are not continuation bytes.
+constexpr auto utf8_count(std::string_view str) -> size_t {
+  const size_t n = str.size();
+
+  size_t count = 0;
+  size_t i     = 0;
+  for (; i + 8 <= n; i += 8) {
+    // A continuation byte has bit 7 set and bit 6 clear
+    const uint64_t w = load8(str, i);
+    count += 8 - std::popcount(w & ~(w << 1) & high_bits);
+  }
+  for (; i < n; ++i) count += !is_continuation(str[i]);
+
+  return count;
+}
+
+// Decodes `str` into `out`, writing U+FFFD for each byte that does not start
+// a valid sequence, and stops once `out` is full. Valid UTF-8 decodes to
+// utf8_count(str) code points; invalid input may need up to str.size().
+// Returns the number of code points written.
+constexpr auto utf8_to_utf32(std::string_view str, std::span<char32_t> out) -> size_t {
+  auto o = out.begin();
+
+  Cursor<char> c(str);
+  while (!c.ended() && o != out.end()) {
+    if (out.end() - o >= 8 && c.remaining() >= 8 && (load8(str, c.begin_ - str.data()) & high_bits) == 0) {
+      for (const char ch : c.take(8)) *o++ = ch;
+      continue;
+    }
+    decode_glyph(*o++, c);
+  }
+
+  return o - out.begin();
+}
+
+// Compile-time literals
+//
+// The routines above are constexpr, so literals can be validated, counted and
+// decoded during compilation and cost nothing at startup:
+//
+//   constexpr auto key = utf32_literal<"ключ">;  // std::array<char32_t, 4>
+//   switch (utf8_hash(input)) { case utf8_hash("ключ"): ... }
+
+// A UTF-8 string literal usable as a template argument. Invalid UTF-8 fails
+// to compile.
+template <size_t N>
+struct Utf8Literal {
+  char data[N]{};
+
+  consteval Utf8Literal(const char (&str)[N]) {
+    std::copy_n(str, N, data);
+    if (utf8_validate(view()) != N - 1) throw "invalid UTF-8 in literal";
+  }
+
+  [[nodiscard]] constexpr auto view() const -> std::string_view { return {data, N - 1}; }
+};
+
+template <Utf8Literal S>
+constexpr size_t utf8_length = utf8_count(S.view());
+
+template <Utf8Literal S>
+constexpr auto utf32_literal = [] {
+  std::array<char32_t, utf8_length<S>> out{};
+  utf8_to_utf32(S.view(), out);
+  return out;
+}();
+
+// FNV-1a hash of the bytes of `str`.
+constexpr auto utf8_hash(std::string_view str) -> uint64_t {
+  uint64_t hash = 0xcbf2'9ce4'8422'2325;
+  for (const char ch : str) hash = (hash ^ static_cast<unsigned char>(ch)) * 0x100'0000'01b3;
+  return hash;
+}
+
+static_assert(utf8_length<"Привет, 世界! 😀"> == 13);
+static_assert(utf32_literal<"ё😀">[1] == U'😀');
+
+// Parallel versions of the bulk routines.
+//
+// The input is cut into one piece per thread, each starting on a lead byte,
+// so the pieces can be processed independently and the results stitched
+// back together in order. Inputs below a few MiB run on the calling thread.
+
+// Splits `str` into at most `parts` pieces of about equal size, each starting
+// on a code point boundary.
+auto utf8_split(std::string_view str, size_t parts) -> std::vector<std::string_view> {
+  std::vector<std::string_view> pieces;
+
+  size_t begin = 0;
+  for (size_t p = 1; p <= parts && begin < str.size(); ++p) {
+    const size_t cut = str.size() * p / parts;
+    size_t end       = cut;
+    for (int k = 0; k < 3 && end > begin && end < str.size() && is_continuation(str[end]); ++k) --end;
+    // Four continuation bytes in a row can never be valid, so the byte at the
+    // cut is an error either way; backing up further could split the valid
+    // sequence before it and report an earlier error than serial validation.
+    if (end > begin && end < str.size() && is_continuation(str[end])) end = cut;
+    if (end > begin) {
+      pieces.push_back(str.substr(begin, end - begin));
+      begin = end;
+    }
+  }
+
+  return pieces;
+}
+
+auto utf8_pieces(std::string_view str, size_t threads) -> std::vector<std::string_view> {
+  constexpr size_t min_piece = size_t{1} << 22;
+  return utf8_split(str, std::max<size_t>(1, std::min<size_t>(threads, str.size() / min_piece)));
+}
+
+// Runs `f` over every piece, one thread per piece with the first on the
+// calling thread, and returns the results in piece order.
+template <typename F>
+auto run_pieces(std::span<const std::string_view> pieces, F f) {
+  std::vector<std::invoke_result_t<F &, size_t, std::string_view>> results(pieces.size());
+  {
+    std::vector<std::jthread> workers;
+    for (size_t i = 1; i < pieces.size(); ++i) {
+      workers.emplace_back([&, i] { results[i] = f(i, pieces[i]); });
+    }
+    if (!pieces.empty()) results[0] = f(0, pieces[0]);
+  }
+  return results;
+}
+
+auto utf8_validate_parallel(std::string_view str, size_t threads = std::thread::hardware_concurrency()) -> size_t {
+  const auto pieces = utf8_pieces(str, threads);
+  const auto errors = run_pieces(pieces, [](size_t, std::string_view p) { return utf8_validate(p); });
+
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    if (errors[i] != pieces[i].size()) return (pieces[i].data() - str.data()) + errors[i];
+  }
+  return str.size();
+}
+
+auto utf8_count_parallel(std::string_view str, size_t threads = std::thread::hardware_concurrency()) -> size_t {
+  const auto pieces = utf8_pieces(str, threads);
+  const auto counts = run_pieces(pieces, [](size_t, std::string_view p) { return utf8_count(p); });
+
+  return std::accumulate(counts.begin(), counts.end(), size_t{0});
+}
+
+// Validates and decodes `str` into `out`. Returns the offset of the first
+// invalid byte, leaving `out` empty, or str.size() on success.
+auto utf8_to_utf32_parallel(std::string_view str, std::u32string &out, size_t threads = std::thread::hardware_concurrency())
+    -> size_t {
+  out.clear();
+
+  // First pass validates and sizes each piece, the second decodes every piece
+  // straight into its slot of the output.
+  const auto pieces = utf8_pieces(str, threads);
+  const auto sizes  = run_pieces(pieces, [](size_t, std::string_view p) {
+    const auto error = utf8_validate(p);
+    return std::pair(error, error == p.size() ? utf8_count(p) : 0);
+  });
+
+  std::vector<size_t> offsets(pieces.size() + 1);
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    if (sizes[i].first != pieces[i].size()) return (pieces[i].data() - str.data()) + sizes[i].first;
+    offsets[i + 1] = offsets[i] + sizes[i].second;
+  }
+
+  out.resize(offsets.back());
+  run_pieces(pieces, [&](size_t i, std::string_view p) {
+    return utf8_to_utf32(p, std::span(out).subspan(offsets[i], offsets[i + 1] - offsets[i]));
+  });
+
+  return str.size();
+}
+
+// Returns a mask with bit i set when p[i] == c, for the 16 bytes at p.
+inline auto match16(const char *p, char c) -> uint32_t {
+#if defined(__SSE2__)
+  const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c)));
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < 16; ++i) mask |= uint32_t{p[i] == c} << i;
+  return mask;
+#endif
+}
+
+// Index of line start offsets in a UTF-8 text that may keep growing.
+//
+// Starts are stored as 32-bit deltas from a 64-bit base per block of 64
+// lines, so the index costs about 4 bytes per line. The rare block spanning
+// 4 GiB or more keeps the starts that do not fit in full on the side.
+// extend() only scans the bytes appended since the last call.
+class LineIndex {
+ public:
+  LineIndex() { push(0); }
+
+  // Indexes the bytes of `text` past scanned(); `text` must be the previously
+  // indexed text with bytes appended.
+  void extend(std::string_view text) {
+    assert(text.size() >= scanned_);
+
+    Cursor<char> c(text.substr(scanned_));
+    while (c.remaining() >= 16) {
+      for (auto mask = match16(c.begin_, '\n'); mask != 0; mask &= mask - 1) {
+        push(c.begin_ - text.data() + std::countr_zero(mask) + 1);
+      }
+      c.advance(16);
+    }
+    while (!c.ended()) {
+      if (c.next() == '\n') push(c.begin_ - text.data());
+    }
+
+    scanned_ = text.size();
+  }
+
+  [[nodiscard]] auto scanned() const -> size_t { return scanned_; }
+
+  // Number of lines; a trailing newline starts an empty last line.
+  [[nodiscard]] auto lines() const -> size_t { return deltas_.size(); }
+
+  [[nodiscard]] auto line_start(size_t line) const -> size_t {
+    assert(line < lines());
+    const auto delta = deltas_[line];
+    if (delta == wide_delta) [[unlikely]] return std::ranges::lower_bound(wide_, line, {}, &WideStart::line)->start;
+    return bases_[line / block_lines] + delta;
+  }
+
+  // Returns `line` of the indexed text without its newline.
+  [[nodiscard]] auto line(std::string_view text, size_t line) const -> std::string_view {
+    const auto begin = line_start(line);
+    const auto end   = line + 1 < lines() ? line_start(line + 1) - 1 : scanned_;
+    return text.substr(begin, end - begin);
+  }
+
+  // Returns the line containing byte `offset`.
+  [[nodiscard]] auto line_of(size_t offset) const -> size_t {
+    const auto block = std::ranges::upper_bound(bases_, offset) - bases_.begin() - 1;
+    const auto first = deltas_.begin() + block * block_lines;
+    const auto last  = block + 1 < std::ssize(bases_) ? first + block_lines : deltas_.end();
+    if (offset - bases_[block] >= wide_delta) [[unlikely]] {
+      // Starts kept in full sort after every delta, so search by start
+      size_t lo = first - deltas_.begin(), hi = last - deltas_.begin();
+      while (hi - lo > 1) {
+        const auto mid = lo + (hi - lo) / 2;
+        (line_start(mid) <= offset ? lo : hi) = mid;
+      }
+      return lo;
+    }
+    return std::upper_bound(first, last, offset - bases_[block]) - deltas_.begin() - 1;
+  }
+
+  // Returns the code point column of byte `offset`, counting from 0.
+  [[nodiscard]] auto column(std::string_view text, size_t offset) const -> size_t {
+    const auto begin = line_start(line_of(offset));
+    return utf8_count(text.substr(begin, offset - begin));
+  }
+
+ private:
+  static constexpr size_t block_lines = 64;
+
+  // Marks a line whose start is in wide_
+  static constexpr uint32_t wide_delta = UINT32_MAX;
+
+  struct WideStart {
+    size_t line;
+    uint64_t start;
+  };
+
+  void push(size_t start) {
+    if (deltas_.size() % block_lines == 0) bases_.push_back(start);
+    const auto delta = start - bases_.back();
+    if (delta >= wide_delta) [[unlikely]] wide_.push_back({deltas_.size(), start});
+    deltas_.push_back(static_cast<uint32_t>(std::min<size_t>(delta, wide_delta)));
+  }
+
+  std::vector<uint64_t> bases_;
+  std::vector<uint32_t> deltas_;
+  std::vector<WideStart> wide_;
+  size_t scanned_ = 0;
+};
+
+// Counts the newlines in `str`, 16 bytes at a time.
+inline auto count_newlines(std::string_view str) -> size_t {
+  Cursor<char> c(str);
+  size_t count = 0;
+  while (c.remaining() >= 16) {
+    count += std::popcount(match16(c.begin_, '\n'));
+    c.advance(16);
+  }
+  while (!c.ended()) count += c.next() == '\n';
+  return count;
+}
+
+// Sizes of a piece of UTF-8 text in each unit a Rope can be indexed by.
+struct TextMetrics {
+  size_t bytes       = 0;
+  size_t code_points = 0;
+  size_t newlines    = 0;
+
+  static auto of(std::string_view str) -> TextMetrics { return {str.size(), utf8_count(str), count_newlines(str)}; }
+
+  constexpr auto operator+=(const TextMetrics &other) -> TextMetrics & {
+    bytes += other.bytes;
+    code_points += other.code_points;
+    newlines += other.newlines;
+    return *this;
+  }
+};
+
+// Editable UTF-8 text for large buffers.
+//
+// The text is cut into leaves of at most max_leaf bytes, each ending on a code
+// point boundary, kept in order in a treap: a binary tree that stays balanced
+// in expectation by keeping random priorities in heap order. Every node caches
+// the metrics of its subtree, so locating a byte, code point or line and
+// inserting or erasing text take O(log n) plus the size of a leaf.
+//
+// Byte offsets passed in must fall on code point boundaries.
+class Rope {
+ public:
+  static constexpr size_t max_leaf = 1024;
+
+  Rope() = default;
+
+  explicit Rope(std::string_view text) { root_ = build(text); }
+
+  [[nodiscard]] auto metrics() const -> TextMetrics { return metrics(root_); }
+
+  [[nodiscard]] auto size() const -> size_t { return metrics().bytes; }
+
+  [[nodiscard]] auto code_points() const -> size_t { return metrics().code_points; }
+
+  // Number of lines; a trailing newline starts an empty last line.
+  [[nodiscard]] auto lines() const -> size_t { return metrics().newlines + 1; }
+
+  // Returns the byte offset of code point `index`, or size() past the end.
+  [[nodiscard]] auto byte_of_char(size_t index) const -> size_t {
+    return locate(index, &TextMetrics::code_points, [](std::string_view leaf, size_t k) {
+      size_t i = 0;
+      for (++k; k > 0; ++i) k -= !is_continuation(leaf[i]);
+      return i - 1;
+    });
+  }
+
+  // Returns the byte offset where `line` starts, or size() past the end.
+  [[nodiscard]] auto byte_of_line(size_t line) const -> size_t {
+    if (line == 0) return 0;
+    return locate(line - 1, &TextMetrics::newlines, [](std::string_view leaf, size_t k) {
+      size_t i = leaf.find('\n');
+      for (; k > 0; --k) i = leaf.find('\n', i + 1);
+      return i + 1;
+    });
+  }
+
+  // Returns the line containing byte `offset`.
+  [[nodiscard]] auto line_of(size_t offset) const -> size_t {
+    size_t line = 0;
+    for (const Node *n = root_.get(); n != nullptr;) {
+      const auto left = metrics(n->left);
+      if (offset < left.bytes) {
+        n = n->left.get();
+        continue;
+      }
+      offset -= left.bytes;
+      line += left.newlines;
+      if (offset < n->leaf.bytes) return line + count_newlines(std::string_view(n->text).substr(0, offset));
+      offset -= n->leaf.bytes;
+      line += n->leaf.newlines;
+      n = n->right.get();
+    }
+    return line;
+  }
+
+  void insert(size_t offset, std::string_view text) {
+    assert(offset <= size());
+    auto [left, right] = split(std::move(root_), offset);
+    root_              = join(join(std::move(left), build(text)), std::move(right));
+  }
+
+  void erase(size_t offset, size_t bytes) {
+    assert(offset + bytes <= size());
+    auto [left, rest]  = split(std::move(root_), offset);
+    auto [gone, right] = split(std::move(rest), bytes);
+    root_              = join(std::move(left), std::move(right));
+  }
+
+  [[nodiscard]] auto substr(size_t offset, size_t bytes) const -> std::string {
+    std::string out;
+    out.reserve(bytes);
+    append(root_.get(), offset, offset + bytes, out);
+    return out;
+  }
+
+  // Returns `line` without its newline.
+  [[nodiscard]] auto line(size_t line) const -> std::string {
+    const auto begin = byte_of_line(line);
+    const auto end   = line + 1 < lines() ? byte_of_line(line + 1) - 1 : size();
+    return substr(begin, end - begin);
+  }
+
+  [[nodiscard]] auto str() const -> std::string { return substr(0, size()); }
+
+ private:
+  struct Node {
+    std::string text;
+    TextMetrics leaf, total;
+    uint32_t priority;
+    std::unique_ptr<Node> left, right;
+  };
+  using NodePtr = std::unique_ptr<Node>;
+
+  static auto metrics(const NodePtr &n) -> TextMetrics { return n ? n->total : TextMetrics{}; }
+
+  static void update(Node &n) {
+    n.total = metrics(n.left);
+    n.total += n.leaf;
+    n.total += metrics(n.right);
+  }
+
+  auto make_leaf(std::string text) -> NodePtr {
+    // xorshift32 is plenty for treap priorities
+    seed_ ^= seed_ << 13;
+    seed_ ^= seed_ >> 17;
+    seed_ ^= seed_ << 5;
+    auto n  = std::make_unique<Node>(std::move(text), TextMetrics{}, TextMetrics{}, seed_);
+    n->leaf = TextMetrics::of(n->text);
+    n->total = n->leaf;
+    return n;
+  }
+
+  // Walks down to the leaf holding unit `index` of `unit` and returns its
+  // byte offset, using `find(leaf, k)` for the k-th unit within the leaf.
+  template <typename F>
+  auto locate(size_t index, size_t TextMetrics::*unit, F find) const -> size_t {
+    size_t offset = 0;
+    for (const Node *n = root_.get(); n != nullptr;) {
+      const auto left = metrics(n->left);
+      if (index < left.*unit) {
+        n = n->left.get();
+        continue;
+      }
+      index -= left.*unit;
+      offset += left.bytes;
+      if (index < n->leaf.*unit) return offset + find(n->text, index);
+      index -= n->leaf.*unit;
+      offset += n->leaf.bytes;
+      n = n->right.get();
+    }
+    return offset;
+  }
+
+  // Cuts `text` into leaves and links them into a treap.
+  auto build(std::string_view text) -> NodePtr {
+    NodePtr root;
+    while (!text.empty()) {
+      size_t end = std::min(text.size(), max_leaf);
+      while (end < text.size() && end > 1 && is_continuation(text[end])) --end;
+      root = merge(std::move(root), make_leaf(std::string(text.substr(0, end))));
+      text.remove_prefix(end);
+    }
+    return root;
+  }
+
+  static auto merge(NodePtr a, NodePtr b) -> NodePtr {
+    if (!a) return b;
+    if (!b) return a;
+    if (a->priority > b->priority) {
+      a->right = merge(std::move(a->right), std::move(b));
+      update(*a);
+      return a;
+    }
+    b->left = merge(std::move(a), std::move(b->left));
+    update(*b);
+    return b;
+  }
+
+  // Splits off the first `offset` bytes, cutting a leaf in two if needed.
+  auto split(NodePtr n, size_t offset) -> std::pair<NodePtr, NodePtr> {
+    if (!n) return {};
+    const auto left_bytes = metrics(n->left).bytes;
+    if (offset <= left_bytes) {
+      auto [a, b] = split(std::move(n->left), offset);
+      n->left     = std::move(b);
+      update(*n);
+      return {std::move(a), std::move(n)};
+    }
+    offset -= left_bytes;
+    if (offset >= n->text.size()) {
+      auto [a, b] = split(std::move(n->right), offset - n->text.size());
+      n->right    = std::move(a);
+      update(*n);
+      return {std::move(n), std::move(b)};
+    }
+
+    auto tail = make_leaf(n->text.substr(offset));
+    n->text.resize(offset);
+    n->leaf    = TextMetrics::of(n->text);
+    auto right = std::move(n->right);
+    update(*n);
+    return {std::move(n), merge(std::move(tail), std::move(right))};
+  }
+
+  // Removes the first (or last) leaf of `n` and returns its text.
+  static auto pop_leaf(NodePtr &n, bool last) -> std::string {
+    auto &child = last ? n->right : n->left;
+    if (child) {
+      auto text = pop_leaf(child, last);
+      update(*n);
+      return text;
+    }
+    auto text = std::move(n->text);
+    n         = std::move(last ? n->left : n->right);
+    return text;
+  }
+
+  static auto edge_leaf(const Node &n, bool last) -> const std::string & {
+    const Node *p = &n;
+    while (const auto &child = last ? p->right : p->left) p = child.get();
+    return p->text;
+  }
+
+  // Concatenates `a` and `b`, combining the leaves on either side of the seam
+  // when they fit in one, so that cuts do not leave a trail of tiny leaves.
+  auto join(NodePtr a, NodePtr b) -> NodePtr {
+    if (a && b && edge_leaf(*a, true).size() + edge_leaf(*b, false).size() <= max_leaf) {
+      auto text = pop_leaf(a, true);
+      text += pop_leaf(b, false);
+      return merge(merge(std::move(a), make_leaf(std::move(text))), std::move(b));
+    }
+    return merge(std::move(a), std::move(b));
+  }
+
+  // Appends the bytes of `n` in [begin, end) to `out`; offsets are relative to `n`.
+  static void append(const Node *n, size_t begin, size_t end, std::string &out) {
+    if (n == nullptr || begin >= end) return;
+    const auto left_bytes = metrics(n->left).bytes;
+    if (begin < left_bytes) append(n->left.get(), begin, std::min(end, left_bytes), out);
+    const auto leaf_begin = std::max(begin, left_bytes), leaf_end = std::min(end, left_bytes + n->text.size());
+    if (leaf_begin < leaf_end) out.append(n->text, leaf_begin - left_bytes, leaf_end - leaf_begin);
+    const auto right_begin = left_bytes + n->text.size();
+    if (end > right_begin) append(n->right.get(), std::max(begin, right_begin) - right_begin, end - right_begin, out);
+  }
+
+  NodePtr root_;
+  uint32_t seed_ = 2463534242;
+};
+
+// Returns a mask with bit i set when p[i] is printable ASCII (0x20-0x7e),
+// for the 16 bytes at p.
+inline auto printable16(const char *p) -> uint32_t {
+#if defined(__SSE2__)
+  // Signed compare: bytes >= 0x80 are negative and fail the first test
+  const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  const auto m = _mm_andnot_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(0x7f)), _mm_cmpgt_epi8(v, _mm_set1_epi8(0x1f)));
+  return _mm_movemask_epi8(m);
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < 16; ++i) mask |= uint32_t{p[i] >= 0x20 && p[i] < 0x7f} << i;
+  return mask;
+#endif
+}
+
+// Terminal columns taken by `cp`, like wcwidth(3): 0 for controls, combining
+// marks and format characters, 2 for wide and fullwidth characters (which
+// include emoji presentation), 1 for everything else.
+constexpr auto range_width(char32_t cp) -> uint8_t {
+  if (cp < 0x7f) return cp >= 0x20;
+  if (cp < 0xa0) return 0;
+  if (in_ranges(cp, zero_width_ranges)) return 0;
+  return in_ranges(cp, wide_ranges) ? 2 : 1;
+}
+
+// Widths of the BMP at two bits per code point, built from the range tables
+// at compile time so that the common case is a single load.
+constexpr auto bmp_widths = [] {
+  std::array<uint8_t, 0x10000 / 4> table{};
+  table.fill(0b01'01'01'01);
+
+  auto set = [&](char32_t first, char32_t last, uint8_t width) {
+    for (auto cp = first; cp <= last && cp < 0x10000; ++cp) {
+      table[cp / 4] = (table[cp / 4] & ~(0b11 << (cp % 4 * 2))) | (width << (cp % 4 * 2));
+    }
+  };
+  set(0x00, 0x1f, 0);
+  set(0x7f, 0x9f, 0);
+  for (auto r : wide_ranges) set(r.first, r.last, 2);
+  for (auto r : zero_width_ranges) set(r.first, r.last, 0);
+
+  return table;
+}();
+
+constexpr auto code_point_width(char32_t cp) -> size_t {
+  if (cp < 0x10000) return (bmp_widths[cp / 4] >> (cp % 4 * 2)) & 0b11;
+  return range_width(cp);
+}
+
+struct WidthPrefix {
+  std::string_view text;
+  size_t width;
+};
+
+// Returns the longest prefix of `str` that fits in `budget` columns, never
+// splitting a code point, together with its width. Zero width characters
+// following the last one that fits are kept with it. Invalid bytes are
+// measured as U+FFFD.
+auto truncate_to_width(std::string_view str, size_t budget) -> WidthPrefix {
+  size_t width = 0;
+
+  Cursor<char> c(str);
+  while (!c.ended()) {
+    if (c.remaining() >= 16) {
+      // Every printable ASCII byte is one column
+      const size_t n = std::min<size_t>(std::countr_one(printable16(c.begin_)), budget - width);
+      if (n > 0) {
+        c.advance(n);
+        width += n;
+        continue;
+      }
+    }
+
+    const char *at = c.begin_;
+    char32_t cp;
+    decode_glyph(cp, c);
+
+    const auto w = code_point_width(cp);
+    if (w > budget - width) {
+      c.begin_ = at;
+      break;
+    }
+    width += w;
+  }
+
+  return {str.substr(0, c.begin_ - str.data()), width};
+}
+
+// Returns the number of terminal columns `str` occupies.
+auto display_width(std::string_view str) -> size_t {
+  return truncate_to_width(str, SIZE_MAX).width;
+}
+
+// Unicode normalization (UAX #15)
+
+enum class NormalForm { NFC, NFD };
+
+enum class QuickCheck { Yes, No, Maybe };
+
+// Hangul syllables are composed and decomposed arithmetically.
+namespace hangul {
+constexpr char32_t s_base = 0xac00, l_base = 0x1100, v_base = 0x1161, t_base = 0x11a7;
+constexpr char32_t l_count = 19, v_count = 21, t_count = 28;
+constexpr char32_t n_count = v_count * t_count, s_count = l_count * n_count;
+}  // namespace hangul
+
+// One bit per BMP code point that the quick check cannot skip: a non-zero
+// combining class, or a quick check value other than Yes for that form.
+// Built from the tables at compile time.
+using BmpBits = std::array<uint64_t, 0x10000 / 64>;
+
+constexpr auto nfc_check_bmp = [] {
+  BmpBits bits{};
+  auto set = [&](char32_t first, char32_t last) {
+    for (auto cp = first; cp <= last && cp < 0x10000; ++cp) bits[cp / 64] |= uint64_t{1} << (cp % 64);
+  };
+  for (auto r : combining_class_ranges) set(r.first, r.last);
+  for (auto r : nfc_qc_no_ranges) set(r.first, r.last);
+  for (auto r : nfc_qc_maybe_ranges) set(r.first, r.last);
+  return bits;
+}();
+
+constexpr auto nfd_check_bmp = [] {
+  BmpBits bits{};
+  auto set = [&](char32_t first, char32_t last) {
+    for (auto cp = first; cp <= last && cp < 0x10000; ++cp) bits[cp / 64] |= uint64_t{1} << (cp % 64);
+  };
+  for (auto r : combining_class_ranges) set(r.first, r.last);
+  for (auto d : decompositions) set(d.cp, d.cp);
+  set(hangul::s_base, hangul::s_base + hangul::s_count - 1);
+  return bits;
+}();
+
+constexpr auto bmp_bit(const BmpBits &bits, char32_t cp) -> bool {
+  return cp < 0x10000 && (bits[cp / 64] >> (cp % 64) & 1);
+}
+
+constexpr auto combining_class(char32_t cp) -> uint8_t {
+  if (cp < 0x10000 && !bmp_bit(nfd_check_bmp, cp)) return 0;
+  const auto it = std::ranges::upper_bound(combining_class_ranges, cp, {}, &CombiningClassRange::first);
+  if (it == combining_class_ranges.begin()) return 0;
+  return cp <= std::prev(it)->last ? std::prev(it)->ccc : 0;
+}
+
+constexpr auto has_decomposition(char32_t cp) -> bool {
+  if (cp - hangul::s_base < hangul::s_count) return true;
+  return std::ranges::binary_search(decompositions, cp, {}, &Decomposition::cp);
+}
+
+// Answers whether `str` is already in `form` without normalizing it (UAX #15
+// section 9). Maybe means only a full normalization can tell.
+constexpr auto quick_check(std::string_view str, NormalForm form) -> QuickCheck {
+  const auto &check = form == NormalForm::NFC ? nfc_check_bmp : nfd_check_bmp;
+
+  auto result        = QuickCheck::Yes;
+  uint8_t last_class = 0;
+
+  Cursor<char> c(str);
+  while (!c.ended()) {
+    if (c.remaining() >= 8 && (load8(str, c.begin_ - str.data()) & high_bits) == 0) {
+      c.advance(8);
+      last_class = 0;
+      continue;
+    }
+
+    char32_t cp;
+    decode_glyph(cp, c);
+    if (cp < 0x10000 && !bmp_bit(check, cp)) {
+      last_class = 0;
+      continue;
+    }
+
+    const auto cc = combining_class(cp);
+    if (cc != 0 && last_class > cc) return QuickCheck::No;
+
+    if (form == NormalForm::NFD) {
+      if (has_decomposition(cp)) return QuickCheck::No;
+    }
+    else {
+      if (in_ranges(cp, nfc_qc_no_ranges)) return QuickCheck::No;
+      if (in_ranges(cp, nfc_qc_maybe_ranges)) result = QuickCheck::Maybe;
+    }
+    last_class = cc;
+  }
+
+  return result;
+}
+
+static_assert(quick_check("e\u0301", NormalForm::NFC) == QuickCheck::Maybe);
+static_assert(quick_check("\u00e9", NormalForm::NFD) == QuickCheck::No);
+
+// Appends the full canonical decomposition of `cp` to `out`.
+void decompose(char32_t cp, std::u32string &out) {
+  if (cp - hangul::s_base < hangul::s_count) {
+    const auto s = cp - hangul::s_base;
+    out += hangul::l_base + s / hangul::n_count;
+    out += hangul::v_base + s % hangul::n_count / hangul::t_count;
+    if (s % hangul::t_count != 0) out += hangul::t_base + s % hangul::t_count;
+    return;
+  }
+
+  if (cp < 0x10000 && !bmp_bit(nfd_check_bmp, cp)) {
+    out += cp;
+    return;
+  }
+
+  const auto it = std::ranges::lower_bound(decompositions, cp, {}, &Decomposition::cp);
+  if (it != decompositions.end() && it->cp == cp) out.append(&decomposition_data[it->offset], it->length);
+  else out += cp;
+}
+
+// Stable-sorts every run of non-starters by combining class.
+void canonical_order(std::u32string &str) {
+  for (size_t i = 1; i < str.size(); ++i) {
+    const char32_t cp = str[i];
+    const auto cc     = combining_class(cp);
+    if (cc == 0) continue;
+
+    size_t j = i;
+    for (; j > 0 && combining_class(str[j - 1]) > cc; --j) str[j] = str[j - 1];
+    str[j] = cp;
+  }
+}
+
+// Returns the primary composite of `first` and `second`, or 0 if there is none.
+constexpr auto compose_pair(char32_t first, char32_t second) -> char32_t {
+  // Only NFC_QC=Maybe code points ever appear second in a pair
+  if (second < 0x10000 && !bmp_bit(nfc_check_bmp, second)) return 0;
+  if (!in_ranges(second, nfc_qc_maybe_ranges)) return 0;
+
+  if (first - hangul::l_base < hangul::l_count && second - hangul::v_base < hangul::v_count) {
+    return hangul::s_base + ((first - hangul::l_base) * hangul::v_count + (second - hangul::v_base)) * hangul::t_count;
+  }
+  if (first - hangul::s_base < hangul::s_count && (first - hangul::s_base) % hangul::t_count == 0 &&
+      second - hangul::t_base - 1 < hangul::t_count - 1) {
+    return first + (second - hangul::t_base);
+  }
+
+  const auto it = std::ranges::lower_bound(compositions, std::pair(first, second), {}, [](const Composition &c) {
+    return std::pair(c.first, c.second);
+  });
+  return it != compositions.end() && it->first == first && it->second == second ? it->composite : 0;
+}
+
+// Canonical composition of a decomposed, canonically ordered string, in place.
+void compose(std::u32string &str) {
+  if (str.empty()) return;
+
+  size_t starter  = 0;
+  int last_class  = combining_class(str[0]) == 0 ? 0 : 256;  // 256: no starter yet
+  size_t composed = 1;
+
+  for (size_t i = 1; i < str.size(); ++i) {
+    const char32_t cp = str[i];
+    const int cc      = combining_class(cp);
+
+    // A mark combines with the starter unless a mark of the same or higher
+    // class sits between them.
+    if (last_class < cc || last_class == 0) {
+      if (const auto composite = compose_pair(str[starter], cp)) {
+        str[starter] = composite;
+        continue;
+      }
+    }
+
+    if (cc == 0) starter = composed;
+    last_class        = cc;
+    str[composed++]   = cp;
+  }
+
+  str.resize(composed);
+}
+
+// Returns `str` itself when it is already in `form`, otherwise normalizes it
+// into `storage` and returns that.
+auto normalize(std::string_view str, NormalForm form, std::string &storage) -> std::string_view {
+  if (quick_check(str, form) == QuickCheck::Yes) return str;
+
+  std::u32string decomposed;
+  decomposed.reserve(str.size());
+
+  Cursor<char> c(str);
+  while (!c.ended()) {
+    char32_t cp;
+    decode_glyph(cp, c);
+    decompose(cp, decomposed);
+  }
+  canonical_order(decomposed);
+  if (form == NormalForm::NFC) compose(decomposed);
+
+  storage.clear();
+  storage.reserve(str.size());
+  for (auto cp : decomposed) encode_glyph(cp, storage);
+
+  return storage;
+}
+
+// Case folding
+
+enum class CaseFold { Simple, Full };
+
+constexpr auto simple_fold(char32_t cp) -> char32_t {
+  if (cp < 0x80) return cp - 'A' < 26 ? cp + 0x20 : cp;
+
+  const auto it = std::ranges::upper_bound(simple_fold_ranges, cp, {}, &CaseFoldRange::first);
+  if (it == simple_fold_ranges.begin()) return cp;
+
+  const auto &r = *std::prev(it);
+  return cp <= r.last && (cp - r.first) % r.stride == 0 ? cp + r.delta : cp;
+}
+
+// One bit per BMP code point that case folding changes, so that code points
+// folding to themselves skip the table searches.
+constexpr auto fold_bmp = [] {
+  BmpBits bits{};
+  for (auto r : simple_fold_ranges) {
+    for (auto cp = r.first; cp <= r.last && cp < 0x10000; cp += r.stride) bits[cp / 64] |= uint64_t{1} << (cp % 64);
+  }
+  for (auto f : full_folds) {
+    if (f.cp < 0x10000) bits[f.cp / 64] |= uint64_t{1} << (f.cp % 64);
+  }
+  return bits;
+}();
+
+// Writes the case folding of `cp` to `out` and returns its length (1 to 3).
+constexpr auto fold_glyph(char32_t cp, CaseFold mode, std::array<char32_t, 3> &out) -> size_t {
+  if (cp < 0x10000 && !bmp_bit(fold_bmp, cp)) {
+    out[0] = cp;
+    return 1;
+  }
+  if (mode == CaseFold::Full && cp >= full_folds.front().cp) {
+    const auto it = std::ranges::lower_bound(full_folds, cp, {}, &FullCaseFold::cp);
+    if (it != full_folds.end() && it->cp == cp) {
+      out = it->folded;
+      return out[2] != 0 ? 3 : 2;
+    }
+  }
+  out[0] = simple_fold(cp);
+  return 1;
+}
+
+// Copies 16 bytes from `in` to `out` with ASCII letters lowercased and
+// returns how many of them, from the start, are ASCII.
+inline auto ascii_fold16(const char *in, char *out) -> size_t {
+#if defined(__SSE2__)
+  const auto v     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+  const auto upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20))));
+  return std::countr_zero(static_cast<uint32_t>(_mm_movemask_epi8(v)) | 0x10000);
+#else
+  size_t n = 16;
+  for (size_t i = 0; i < 16; ++i) {
+    out[i] = static_cast<unsigned>(in[i] - 'A') < 26u ? in[i] + 0x20 : in[i];
+    if (in[i] & 0x80) n = std::min(n, i);
+  }
+  return n;
+#endif
+}
+
+// Appends the case folding of `str` to `out`.
+void case_fold(std::string_view str, std::string &out, CaseFold mode = CaseFold::Full) {
+  out.reserve(out.size() + str.size());
+
+  Cursor<char> c(str);
+  while (!c.ended()) {
+    if (c.remaining() >= 16) {
+      char block[16];
+      if (const auto n = ascii_fold16(c.begin_, block)) {
+        out.append(block, n);
+        c.advance(n);
+        continue;
+      }
+    }
+
+    const char *at = c.begin_;
+    char32_t cp;
+    decode_glyph(cp, c);
+
+    std::array<char32_t, 3> folded;
+    const auto n = fold_glyph(cp, mode, folded);
+    if (n == 1 && folded[0] == cp && cp != U'\ufffd') {
+      out.append(at, c.begin_);  // Unchanged, no need to re-encode
+      continue;
+    }
+    for (size_t i = 0; i < n; ++i) encode_glyph(folded[i], out);
+  }
+}
+
+// Yields the case folded code points of a string one at a time.
+class FoldCursor {
+ public:
+  FoldCursor(std::string_view str, CaseFold mode) : cursor_(str), mode_(mode) {}
+
+  [[nodiscard]] auto ended() const -> bool { return pos_ == len_ && cursor_.ended(); }
+
+  auto next() -> char32_t {
+    if (pos_ == len_) {
+      char32_t cp;
+      decode_glyph(cp, cursor_);
+      len_ = fold_glyph(cp, mode_, pending_);
+      pos_ = 0;
+    }
+    return pending_[pos_++];
+  }
+
+  // Skips the ASCII bytes, up to 16, that fold the same as the next bytes
+  // of `other`, and returns whether there were any.
+  auto skip_equal_ascii(FoldCursor &other) -> bool {
+    if (pos_ != len_ || other.pos_ != other.len_) return false;
+    if (cursor_.remaining() < 16 || other.cursor_.remaining() < 16) return false;
+
+    char a[16], b[16];
+    const auto n = std::min(ascii_fold16(cursor_.begin_, a), ascii_fold16(other.cursor_.begin_, b));
+    const auto m = std::mismatch(a, a + n, b).first - a;
+
+    cursor_.advance(m);
+    other.cursor_.advance(m);
+    return m != 0;
+  }
+
+ private:
+  Cursor<char> cursor_;
+  CaseFold mode_;
+  std::array<char32_t, 3> pending_{};
+  size_t pos_ = 0, len_ = 0;
+};
+
+// Orders `a` and `b` by their case folded code points, folding lazily and
+// without allocating.
+auto compare_folded(std::string_view a, std::string_view b, CaseFold mode = CaseFold::Full) -> std::strong_ordering {
+  FoldCursor x(a, mode), y(b, mode);
+  while (!x.ended() && !y.ended()) {
+    if (x.skip_equal_ascii(y)) continue;
+    if (auto order = x.next() <=> y.next(); order != 0) return order;
+  }
+  return !x.ended() <=> !y.ended();
+}
+
+auto equal_folded(std::string_view a, std::string_view b, CaseFold mode = CaseFold::Full) -> bool {
+  return compare_folded(a, b, mode) == 0;
+}
+
+// Substring search
+//
+// Byte-wise search can report a match inside a multibyte sequence when the
+// pattern starts or ends part way through one (e.g. a lone continuation
+// byte). These only report matches that start and end on code point
+// boundaries.
+
+constexpr auto is_boundary(std::string_view str, size_t pos) -> bool {
+  return pos == str.size() || !is_continuation(str[pos]);
+}
+
+constexpr auto matches_at(std::string_view str, std::string_view pattern, size_t pos) -> bool {
+  return str.compare(pos, pattern.size(), pattern) == 0 && is_boundary(str, pos) && is_boundary(str, pos + pattern.size());
+}
+
+// Returns the offset of the first code point aligned occurrence of `pattern`
+// at or after `from`, or npos. An empty pattern matches at `from`.
+//
+// Candidates are found 16 positions at a time by comparing one block against
+// the pattern's first byte and another, pattern.size() - 1 bytes further on,
+// against its last byte; only positions where both agree are compared.
+auto utf8_find(std::string_view str, std::string_view pattern, size_t from = 0) -> size_t {
+  constexpr auto npos = std::string_view::npos;
+
+  const size_t m = pattern.size();
+  if (from > str.size()) return npos;
+  if (m == 0) return from;
+
+  size_t i = from;
+#if defined(__SSE2__)
+  if (m > 1) {
+    const auto first = _mm_set1_epi8(pattern.front());
+    const auto last  = _mm_set1_epi8(pattern.back());
+    for (; i + m - 1 + 16 <= str.size(); i += 16) {
+      const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str.data() + i));
+      const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str.data() + i + m - 1));
+      for (uint32_t mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))); mask != 0;
+           mask &= mask - 1) {
+        const auto pos = i + std::countr_zero(mask);
+        if (matches_at(str, pattern, pos)) return pos;
+      }
+    }
+  }
+#endif
+
+  for (i = str.find(pattern, i); i != npos; i = str.find(pattern, i + 1)) {
+    if (is_boundary(str, i) && is_boundary(str, i + m)) return i;
+  }
+  return npos;
+}
+
+struct PatternMatch {
+  size_t pos;      // Offset of the match, or npos
+  size_t pattern;  // Index of the pattern that matched
+};
+
+// Searches for any of a set of patterns at once.
+//
+// Patterns are spread over 8 buckets, and each bucket is registered in
+// 16-entry tables indexed by the low and high nibbles of the first and of
+// the second byte of its patterns. With SSSE3 a block of 16 positions is then
+// screened with four shuffles: a position survives only if some bucket
+// accepts both of its first two bytes. Survivors are checked against the
+// patterns with that first byte, in the order they were given.
+//
+// The patterns are not copied: the strings they view must outlive the
+// MultiPattern. As with utf8_find, an empty pattern matches at `from`.
+class MultiPattern {
+ public:
+  explicit MultiPattern(std::span<const std::string_view> patterns) : patterns_(patterns.begin(), patterns.end()) {
+    for (size_t i = 0; i < patterns_.size(); ++i) {
+      const auto &p = patterns_[i];
+      if (p.empty()) {
+        first_empty_ = std::min(first_empty_, i);
+        continue;
+      }
+
+      const auto bucket = uint8_t(1 << (i % 8));
+      const auto b0     = static_cast<unsigned char>(p[0]);
+      nibbles_[0][b0 & 0xf] |= bucket;
+      nibbles_[1][b0 >> 4] |= bucket;
+      if (p.size() > 1) {
+        const auto b1 = static_cast<unsigned char>(p[1]);
+        nibbles_[2][b1 & 0xf] |= bucket;
+        nibbles_[3][b1 >> 4] |= bucket;
+      }
+      else {
+        // Any second byte will do
+        for (auto &n : nibbles_[2]) n |= bucket;
+        for (auto &n : nibbles_[3]) n |= bucket;
+      }
+      by_first_[b0].push_back(i);
+    }
+  }
+
+  // Returns the leftmost code point aligned match at or after `from`; among
+  // patterns matching at the same offset the earliest given wins.
+  [[nodiscard]] auto find(std::string_view str, size_t from = 0) const -> PatternMatch {
+    if (first_empty_ != npos && from <= str.size()) {
+      // Nothing matches further left; only patterns given earlier can win
+      for (size_t p = 0; p < first_empty_; ++p) {
+        if (matches_at(str, patterns_[p], from)) return {from, p};
+      }
+      return {from, first_empty_};
+    }
+
+    size_t i = from;
+#if defined(__SSSE3__)
+    auto table      = [&](size_t k) { return _mm_load_si128(reinterpret_cast<const __m128i *>(nibbles_[k].data())); };
+    const auto low4 = _mm_set1_epi8(0x0f);
+    auto lookup     = [&](__m128i v, size_t k) {
+      const auto lo = _mm_shuffle_epi8(table(k), _mm_and_si128(v, low4));
+      const auto hi = _mm_shuffle_epi8(table(k + 1), _mm_and_si128(_mm_srli_epi16(v, 4), low4));
+      return _mm_and_si128(lo, hi);
+    };
+
+    for (; i + 17 <= str.size(); i += 16) {
+      const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str.data() + i));
+      const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str.data() + i + 1));
+      const auto c  = _mm_cmpeq_epi8(_mm_and_si128(lookup(v0, 0), lookup(v1, 2)), _mm_setzero_si128());
+      for (uint32_t mask = ~_mm_movemask_epi8(c) & 0xffff; mask != 0; mask &= mask - 1) {
+        if (auto match = match_at(str, i + std::countr_zero(mask)); match.pos != npos) return match;
+      }
+    }
+#endif
+    for (; i < str.size(); ++i) {
+      if (auto match = match_at(str, i); match.pos != npos) return match;
+    }
+    return {npos, 0};
+  }
+
+ private:
+  static constexpr auto npos = std::string_view::npos;
+
+  [[nodiscard]] auto match_at(std::string_view str, size_t pos) const -> PatternMatch {
+    for (auto p : by_first_[static_cast<unsigned char>(str[pos])]) {
+      if (matches_at(str, patterns_[p], pos)) return {pos, p};
+    }
+    return {npos, 0};
+  }
+
+  std::vector<std::string_view> patterns_;
+  std::array<std::vector<size_t>, 256> by_first_;
+  size_t first_empty_ = npos;
+  // First byte low/high nibble, then second byte low/high nibble
+  alignas(16) std::array<std::array<uint8_t, 16>, 4> nibbles_{};
+};
+
+// Property tables
+//
+// A property given as runs of (first << 8) | value is looked up through two
+// stages: the top bits of a code point select one of the distinct 256-entry
+// blocks, the low byte indexes it. Blocks are deduplicated when the table is
+// built at compile time, which leaves a few tens of kilobytes per property.
+
+struct PropertyBlocks {
+  std::array<uint16_t, 0x1100> index{};
+  std::vector<std::array<uint8_t, 256>> blocks;
+};
+
+// Splits the code space into blocks and deduplicates them. Blocks lying in a
+// single run are uniform and found by value; the others are compared by hash
+// first.
+template <size_t N>
+constexpr auto split_property_blocks(const std::array<uint32_t, N> &runs) -> PropertyBlocks {
+  PropertyBlocks out;
+  std::array<int, 256> uniform;
+  uniform.fill(-1);
+  std::vector<uint32_t> hashes;
+  size_t r = 0;  // Run containing the start of the current block
+  for (size_t b = 0; b < out.index.size(); ++b) {
+    const auto first = static_cast<uint32_t>(b * 256);
+    while (r + 1 < N && (runs[r + 1] >> 8) <= first) ++r;
+    if (r + 1 == N || (runs[r + 1] >> 8) >= first + 256) {
+      const auto value = runs[r] & 0xff;
+      if (uniform[value] < 0) {
+        uniform[value] = static_cast<int>(out.blocks.size());
+        out.blocks.emplace_back().fill(static_cast<uint8_t>(value));
+        hashes.push_back(0);
+      }
+      out.index[b] = static_cast<uint16_t>(uniform[value]);
+      continue;
+    }
+    std::array<uint8_t, 256> block{};
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0, k = r; i < 256; ++i) {
+      while (k + 1 < N && (runs[k + 1] >> 8) <= first + i) ++k;
+      block[i] = static_cast<uint8_t>(runs[k] & 0xff);
+      hash = (hash ^ block[i]) * 16777619u;
+    }
+    size_t found = out.blocks.size();
+    for (size_t j = 0; j < hashes.size(); ++j) {
+      if (hashes[j] == hash && out.blocks[j] == block) {
+        found = j;
+        break;
+      }
+    }
+    if (found == out.blocks.size()) {
+      out.blocks.push_back(block);
+      hashes.push_back(hash);
+    }
+    out.index[b] = static_cast<uint16_t>(found);
+  }
+  return out;
+}
+
+template <size_t NBlocks>
+struct PropertyTable {
+  std::array<uint16_t, 0x1100> index{};
+  std::array<uint8_t, NBlocks * 256> values{};
+
+  // Out of range code points read as the last one, U+10FFFF, without a branch.
+  constexpr auto operator[](char32_t cp) const -> uint8_t {
+    cp = std::min<char32_t>(cp, 0x10ffff);
+    return values[size_t{index[cp >> 8]} * 256 + (cp & 0xff)];
+  }
+};
+
+template <const auto &Runs>
+constexpr auto make_property_table() {
+  constexpr auto n = split_property_blocks(Runs).blocks.size();
+  const auto split = split_property_blocks(Runs);
+  PropertyTable<n> table;
+  table.index = split.index;
+  for (size_t j = 0; j < n; ++j) std::ranges::copy(split.blocks[j], table.values.begin() + j * 256);
+  return table;
+}
+
+constexpr auto char_classes = make_property_table<char_class_runs>();
+constexpr auto word_classes = make_property_table<word_class_runs>();
+
+// Returns the CharClass bits of `cp`.
+constexpr auto char_class(char32_t cp) -> uint8_t {
+  return char_classes[cp];
+}
+
+// Word segmentation
+
+constexpr auto word_class(char32_t cp) -> WordClass {
+  return static_cast<WordClass>(word_classes[cp]);
+}
+
+// Returns a mask with bit i set when p[i] is an ASCII letter, digit or '_',
+// for the 16 bytes at p.
+inline auto ascii_word16(const char *p) -> uint32_t {
+#if defined(__SSE2__)
+  // Signed compares, so bytes >= 0x80 fall outside every range
+  const auto v     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  const auto lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+  auto in_range    = [](__m128i x, char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(lo - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8(hi + 1)));
+  };
+  const auto word = _mm_or_si128(_mm_or_si128(in_range(lower, 'a', 'z'), in_range(v, '0', '9')),
+                                 _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+  return _mm_movemask_epi8(word);
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < 16; ++i) {
+    const auto k = p[i] & 0x80 ? WordClass::Other : word_class(p[i]);
+    mask |= uint32_t{k == WordClass::ALetter || k == WordClass::Numeric || k == WordClass::ExtendNumLet} << i;
+  }
+  return mask;
+#endif
+}
+
+// Returns a mask with bit i set when p[i] is not ASCII, for the 16 bytes at p.
+inline auto non_ascii16(const char *p) -> uint32_t {
+#if defined(__SSE2__)
+  return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < 16; ++i) mask |= uint32_t{(p[i] & 0x80) != 0} << i;
+  return mask;
+#endif
+}
+
+// Whether no word boundary falls between classes `a` and `b` (WB5, WB8-10,
+// WB13, WB13a-b).
+constexpr auto word_joins(WordClass a, WordClass b) -> bool {
+  using enum WordClass;
+  const bool a_alnum = a == ALetter || a == Numeric;
+  const bool b_alnum = b == ALetter || b == Numeric;
+  if (a_alnum && b_alnum) return true;
+  if (a == Katakana && b == Katakana) return true;
+  if (b == ExtendNumLet) return a_alnum || a == Katakana || a == ExtendNumLet;
+  if (a == ExtendNumLet) return b_alnum || b == Katakana;
+  return false;
+}
+
+// Consumes the code point at `c`, then any Extend/Format code points after it
+// (WB4), and returns the first code point's class.
+inline auto take_word_glyph(Cursor<char> &c) -> WordClass {
+  char32_t cp;
+  decode_glyph(cp, c);
+  const auto k = word_class(cp);
+
+  for (auto peek = c; !peek.ended();) {
+    decode_glyph(cp, peek);
+    if (word_class(cp) != WordClass::Extend) break;
+    c = peek;
+  }
+  return k;
+}
+
+inline auto peek_word_class(Cursor<char> c) -> WordClass {
+  char32_t cp;
+  decode_glyph(cp, c);
+  return word_class(cp);
+}
+
+// Returns the next word of the text under `c`: a segment of letters, numbers,
+// Katakana or a single ideograph, joined by the UAX #29 rules for
+// punctuation inside words ("can't", "3.14", "e.g"). Whitespace, symbols and
+// other punctuation are skipped.
+auto next_word(Cursor<char> &c) -> std::optional<std::string_view> {
+  using enum WordClass;
+
+  while (!c.ended()) {
+    if (c.remaining() >= 16) {
+      // ASCII separators can be skipped in bulk
+      const auto candidates = ascii_word16(c.begin_) | non_ascii16(c.begin_);
+      if (const auto skip = std::countr_zero(candidates | 0x10000)) {
+        c.advance(skip);
+        continue;
+      }
+    }
+
+    const char *start = c.begin_;
+    auto prev         = take_word_glyph(c);
+    if (prev != ALetter && prev != Numeric && prev != Katakana && prev != Ideographic && prev != ExtendNumLet) continue;
+    if (prev == Ideographic) return std::string_view(start, c.begin_);
+
+    bool has_word = prev != ExtendNumLet;
+    while (!c.ended()) {
+      if (c.remaining() >= 16 && (prev == ALetter || prev == Numeric || prev == ExtendNumLet)) {
+        // Runs of ASCII letters, digits and '_' always join
+        const auto word = ascii_word16(c.begin_);
+        if (const auto n = std::countr_one(word)) {
+          const auto alnum = word & ~match16(c.begin_, '_') & ((1u << n) - 1);
+          has_word |= alnum != 0;
+
+          const char last = c.begin_[n - 1];
+          prev            = last == '_' ? ExtendNumLet : last <= '9' ? Numeric : ALetter;
+          c.advance(n);
+          continue;
+        }
+      }
+
+      auto after = c;
+      const auto next = take_word_glyph(after);
+      if (next == Extend) {
+        // WB4: a mark after a run taken in bulk belongs to its last letter
+        c = after;
+        continue;
+      }
+      if (word_joins(prev, next)) {
+        c        = after;
+        prev     = next;
+        has_word = has_word || next != ExtendNumLet;
+        continue;
+      }
+
+      // WB6-7 and WB11-12: a single separator between two letters or two
+      // numbers
+      const bool mid_letter = next == MidLetter || next == MidNumLet || next == SingleQuote;
+      const bool mid_num    = next == MidNum || next == MidNumLet || next == SingleQuote;
+      if ((prev == ALetter && mid_letter) || (prev == Numeric && mid_num)) {
+        if (!after.ended() && peek_word_class(after) == prev) {
+          take_word_glyph(after);
+          c = after;
+          continue;
+        }
+      }
+      break;
+    }
+
+    if (has_word) return std::string_view(start, c.begin_);
+  }
+
+  return std::nullopt;
+}
+
+constexpr auto iterWords(std::string_view str) {
+  return Stream(
+      str,
+      [](auto &c) -> std::optional<std::string_view>
+      {
+        return next_word(c);
+      }
+  );
+}
+
+// Character classification
+
+// Class bitmaps of up to 64 consecutive code points: bit i of `alpha` is set
+// when the i-th of them is alphabetic, and so on.
+struct ClassBitmaps {
+  Bitset<64> alpha, digit, space, punct;
+  size_t count = 0;  // Code points covered
+};
+
+// Classifies up to 64 code points at `c`. Class bytes are gathered first,
+// ASCII blocks without decoding, then transposed into one bitmap per class.
+// Invalid bytes are classified as U+FFFD, which has no class.
+auto classify64(Cursor<char> &c) -> ClassBitmaps {
+  alignas(16) std::array<uint8_t, 64> classes{};
+  size_t n = 0;
+  while (n < 64 && !c.ended()) {
+    if (n <= 48 && c.remaining() >= 16 && non_ascii16(c.begin_) == 0) {
+      for (size_t i = 0; i < 16; ++i) classes[n + i] = char_classes[static_cast<unsigned char>(c.begin_[i])];
+      c.advance(16);
+      n += 16;
+      continue;
+    }
+    char32_t cp;
+    decode_glyph(cp, c);
+    classes[n++] = char_classes[cp];
+  }
+
+  std::array<uint64_t, 4> masks{};
+#if defined(__SSE2__)
+  for (size_t i = 0; i < 64; i += 16) {
+    const auto v = _mm_load_si128(reinterpret_cast<const __m128i *>(classes.data() + i));
+    // Shift each class bit into the sign bit of its byte
+    masks[0] |= uint64_t(_mm_movemask_epi8(_mm_slli_epi16(v, 7))) << i;
+    masks[1] |= uint64_t(_mm_movemask_epi8(_mm_slli_epi16(v, 6))) << i;
+    masks[2] |= uint64_t(_mm_movemask_epi8(_mm_slli_epi16(v, 5))) << i;
+    masks[3] |= uint64_t(_mm_movemask_epi8(_mm_slli_epi16(v, 4))) << i;
+  }
+#else
+  for (size_t i = 0; i < 64; ++i) {
+    for (size_t b = 0; b < 4; ++b) masks[b] |= uint64_t((classes[i] >> b) & 1) << i;
+  }
+#endif
+  static_assert(CharClass::alpha == 1 && CharClass::digit == 2 && CharClass::space == 4 && CharClass::punct == 8);
+  return {masks[0], masks[1], masks[2], masks[3], n};
+}
+
+// Classifies every code point of `str`, 64 at a time.
+auto classify(std::string_view str) -> std::vector<ClassBitmaps> {
+  std::vector<ClassBitmaps> out;
+  out.reserve(str.size() / 64 + 1);
+  Cursor<char> c(str);
+  while (!c.ended()) out.push_back(classify64(c));
+  return out;
+}
+
+// Benchmarks
+
+// A synthetic benchmark input.
+struct Corpus {
+  std::string_view name;
+  std::string text;
+};
+
+// Appends words drawn at random from `words`, separated by spaces and the odd
+// newline, until `out` holds about `bytes` bytes.
+void fill_words(std::string &out, std::span<const std::string_view> words, size_t bytes, std::minstd_rand &rng) {
+  while (out.size() < bytes) {
+    out += words[rng() % words.size()];
+    out += rng() % 12 == 0 ? '\n' : ' ';
+  }
+}
+
+// Builds the benchmark corpora, each about `bytes` long: pure ASCII, Latin
+// with accents (mostly 1-2 byte sequences), Cyrillic (2 bytes), CJK (3
+// bytes), emoji with ZWJ sequences and modifiers (4 bytes), and ASCII text
+// with random bytes scattered through it.
+auto make_corpora(size_t bytes) -> std::vector<Corpus> {
+  static constexpr std::array<std::string_view, 12> ascii{"Hello", "World,", "from", "Japan", "and", "other", "places.",
+                                                          "0123456789", "the", "quick", "brown", "fox"};
+  static constexpr std::array<std::string_view, 12> latin{"Ça",     "a",         "déjà",    "été",  "vu:",     "naïve",
+                                                          "façade", "Ångström,", "Straße", "über", "żółć", "año"};
+  static constexpr std::array<std::string_view, 10> cyrillic{"Привет", "мир,",   "из",     "Японии", "и",
+                                                             "других", "мест.", "города", "страны", "Ёлка"};
+  static constexpr std::array<std::string_view, 10> cjk{"日本語の", "文章です。", "東京", "大阪", "漢字",
+                                                        "カタカナ", "ひらがな", "中文", "한국어", "。"};
+  static constexpr std::array<std::string_view, 8> emoji{"😀", "👍🏽", "👨‍👩‍👧‍👦", "🇯🇵", "🎉🎉", "❤️", "🚀", "🧑‍💻"};
+
+  std::minstd_rand rng(42);
+  std::vector<Corpus> corpora;
+  corpora.reserve(6);
+  for (auto [name, words] : {std::pair<std::string_view, std::span<const std::string_view>>{"ascii", ascii},
+                             {"latin", latin},
+                             {"cyrillic", cyrillic},
+                             {"cjk", cjk},
+                             {"emoji", emoji}}) {
+    fill_words(corpora.emplace_back(name).text, words, bytes, rng);
+  }
+
+  auto &invalid = corpora.emplace_back("invalid").text;
+  fill_words(invalid, ascii, bytes, rng);
+  for (size_t i = rng() % 64; i < invalid.size(); i += 1 + rng() % 64) invalid[i] = static_cast<char>(0x80 | rng());
+  return corpora;
+}
+
+// Times `f` over `input`, keeping the best of a few runs, and reports its
+// throughput in bytes and code points.
+template <typename F>
+void bench(std::string_view name, std::string_view input, F &&f) {
+  using namespace std::chrono;
+  const auto code_points = utf8_count(input);
+
+  auto best   = duration<double>::max();
+  auto result = f();
+  for (int run = 0; run < 3; ++run) {
+    const auto begin = steady_clock::now();
+    result           = f();
+    best             = std::min<duration<double>>(best, steady_clock::now() - begin);
+  }
+  const auto secs = best.count();
+  std::println("{:<32} {:8.3f} GB/s {:9.1f} Mcp/s  (result: {})", name, input.size() / secs / 1e9, code_points / secs / 1e6, result);
+}
+
+// Compares the fused adaptors against the equivalent std::ranges views.
+void benchCombinators(std::string_view corpus) {
+  auto is_upper = [](unsigned char c) { return c >= 'A' && c <= 'Z'; };
+  auto widen    = [](unsigned char c) { return size_t{c}; };
+  auto any      = [](unsigned char) { return true; };
+
+  bench("ranges transform|filter|fold", corpus, [&] {
+    size_t sum = 0;
+    for (auto c : corpus | std::views::take_while(any) | std::views::filter(is_upper) | std::views::transform(widen)) sum += c;
+    return sum;
+  });
+
+  bench("stream take_while|filter|map", corpus, [&] {
+    return (iterChars(corpus) | take_while(any) | filter(is_upper) | map(widen)).fold(size_t{0}, std::plus{});
+  });
+
+  bench("stream graphemes|enumerate|chunk", corpus, [&] {
+    auto sum_chunk = [](auto chunk) { return chunk.back().first; };
+    return (iterGraphemes(corpus) | enumerate() | chunk<16>() | map(sum_chunk)).fold(size_t{0}, std::plus{});
+  });
+}
+
+// Compares random edits on a Rope and on a std::string holding `corpus`.
+void benchRope(std::string_view corpus) {
+  using namespace std::chrono;
+  constexpr size_t edits = 20000;
+
+  auto time_edits = [&](auto &text, auto insert, auto erase) {
+    std::minstd_rand rng(1);
+    const auto begin = steady_clock::now();
+    for (size_t i = 0; i < edits; ++i) {
+      // Edits at ASCII positions stay on code point boundaries
+      const size_t at = std::min(corpus.find(' ', rng() % corpus.size()), corpus.size() - 8);
+      if (i % 2 == 0)
+        insert(text, at, "edit ");
+      else
+        erase(text, at, 5);
+    }
+    return duration<double, std::nano>(steady_clock::now() - begin).count() / edits;
+  };
+
+  Rope rope(corpus);
+  std::string str(corpus);
+  const auto rope_ns = time_edits(
+      rope, [](Rope &r, size_t at, std::string_view t) { r.insert(at, t); }, [](Rope &r, size_t at, size_t n) { r.erase(at, n); });
+  const auto str_ns = time_edits(
+      str, [](std::string &s, size_t at, std::string_view t) { s.insert(at, t); }, [](std::string &s, size_t at, size_t n) { s.erase(at, n); });
+  std::println("{:<32} {:8.0f} ns/edit (std::string: {:.0f} ns/edit)", "Rope insert/erase", rope_ns, str_ns);
+}
+
+// Runs every routine over `corpus`. Routines that stop at the first invalid
+// byte are only timed on valid input, where they have to read all of it.
+void benchCorpus(std::string_view corpus) {
+  const bool valid = utf8_validate(corpus) == corpus.size();
+
+  bench("utf8_validate (all errors)", corpus, [&] {
+    size_t errors = 0;
+    for (size_t at = 0; (at += utf8_validate(corpus.substr(at))) < corpus.size(); ++at) ++errors;
+    return errors;
+  });
+  if (valid) bench("utf8_validate_parallel", corpus, [&] { return utf8_validate_parallel(corpus); });
+  bench("decode_glyph", corpus, [&] {
+    Cursor<char> c(corpus);
+    size_t n = 0;
+    for (char32_t cp; !c.ended(); ++n) decode_glyph(cp, c);
+    return n;
+  });
+  bench("utf8_count", corpus, [&] { return utf8_count(corpus); });
+  bench("utf8_count_parallel", corpus, [&] { return utf8_count_parallel(corpus); });
+
+  std::u32string out(corpus.size(), U'\0');
+  bench("utf8_to_utf32", corpus, [&] { return utf8_to_utf32(corpus, out); });
+  if (valid) bench("utf8_to_utf32_parallel", corpus, [&] { return utf8_to_utf32_parallel(corpus, out); });
+
+  bench("iterWords", corpus, [&] { return iterWords(corpus).count(); });
+  bench("classify", corpus, [&] { return classify(corpus).size(); });
+  bench("display_width", corpus, [&] { return display_width(corpus); });
+
+  std::string storage, nfc;
+  if (valid) bench("quick_check NFC", corpus, [&] { return quick_check(corpus, NormalForm::NFC) == QuickCheck::Yes; });
+  bench("normalize NFD", corpus, [&] { return normalize(corpus, NormalForm::NFD, storage).size(); });
+  const std::string nfd(normalize(corpus, NormalForm::NFD, storage));
+  bench("normalize NFC (from NFD)", nfd, [&] { return normalize(nfd, NormalForm::NFC, nfc).size(); });
+
+  std::string folded;
+  bench("case_fold", corpus, [&] {
+    folded.clear();
+    case_fold(corpus, folded);
+    return folded.size();
+  });
+  bench("equal_folded", corpus, [&] { return equal_folded(corpus, folded); });
+
+  bench("string_view::find", corpus, [&] { return corpus.find("места!"); });
+  bench("utf8_find", corpus, [&] { return utf8_find(corpus, "места!"); });
+
+  const std::array<std::string_view, 6> patterns{"Tokyo", "Osaka", "города!", "страны!", "日本!", "😀!"};
+  bench("MultiPattern::find", corpus, [&] { return MultiPattern(patterns).find(corpus).pos; });
+
+  bench("Rope build", corpus, [&] { return Rope(corpus).lines(); });
+  bench("LineIndex::extend", corpus, [&] {
+    LineIndex index;
+    index.extend(corpus);
+    return index.lines();
+  });
+}
+
+int main(int argc, char *argv[]) {
+  if (argc > 1 && std::string_view(argv[1]) == "bench") {
+    const size_t mib = argc > 2 ? std::stoul(argv[2]) : 16;
+    const auto corpora = make_corpora(mib << 20);
+
+    std::println("== combinators (ascii)");
+    benchCombinators(corpora.front().text);
+    benchRope(corpora.front().text);
+    for (const auto &corpus : corpora) {
+      std::println("\n== {} ({} MiB, {} code points)", corpus.name, mib, utf8_count(corpus.text));
+      benchCorpus(corpus.text);
+    }
+    return 0;
+  }
+
+  if (argc > 2 && std::string_view(argv[1]) == "count") {
+    auto file = MappedFile::open(argv[2]);
+    if (!file) {
+      std::println("failed to map {}", argv[2]);
+      return 1;
+    }
+    std::println("{} bytes, {} code points", file->size(), iterGraphemes(*file).count());
+    return 0;
+  }
+
+  if (argc > 3 && std::string_view(argv[1]) == "line") {
+    auto file = MappedFile::open(argv[2]);
+    if (!file) {
+      std::println("failed to map {}", argv[2]);
+      return 1;
+    }
+    LineIndex index;
+    index.extend(*file);
+    const auto n = std::min<size_t>(std::stoul(argv[3]), index.lines() - 1);
+    std::println("{}/{}: {}", n, index.lines(), index.line(*file, n));
+    return 0;
+  }
+
+  std::string test = "Hello World, from Japan and други места.\n";
+
+  size_t len = 0;
+  for (auto ch : iterGraphemes(test)) {
+    std::println("ch: {}", (char)ch);
+    len++;
+  }
+
+  for (auto ch : iterChars(test)) {
+    std::println("ch: {}", ch);
+  }
+
+  // A combining mark stays in its word, near the end of the text or with
+  // enough text after it for the bulk path
+  for (std::string_view text : {"cafe\u0301 x", "cafe\u0301 and a long tail of words"}) {
+    auto words = iterWords(text);
+    assert(words.next() == "cafe\u0301");
+  }
+
+  // Split pieces report the same first error as serial validation, and
+  // decoding invalid bytes stays within the output
+  const std::string_view overlong = "\xF0\x90\x80\x80\x80\x80";
+  for (const auto piece : utf8_split(overlong, 6)) {
+    if (const auto error = utf8_validate(piece); error != piece.size()) {
+      assert(size_t(piece.data() - overlong.data()) + error == utf8_validate(overlong));
+      break;
+    }
   }
+  std::array<char32_t, 1> decoded{};
+  assert(utf8_to_utf32(overlong, decoded) == decoded.size());
 }
 